@@ -0,0 +1,1608 @@
+/* vim: set ai et ts=4 sw=4: */
+// Source artwork for the generated image assets: raw big-endian RGB565 with
+// an 8-byte header. Not linked into the firmware; src/CMakeLists.txt runs
+// tools/rle_image.py over it to make arducam_logo_rle.
+#include <stdint.h>
+
+const uint8_t arducam_logo[25608] = { 0X10,0X10,0X00,0X50,0X00,0XA0,0X01,0X1B,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X18,0XC3,0X10,0X82,0X10,0X82,0X10,0X82,0X18,0XC3,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X18,0XA3,
+0X10,0X00,0X10,0X00,0X10,0X00,0X18,0X00,0X18,0X00,0X10,0X00,0X10,0X00,0X18,0X82,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X10,0X82,0X10,0X61,0X08,0X00,
+0X28,0X00,0X58,0X44,0X80,0XE7,0X80,0XC7,0X80,0XE7,0X68,0X85,0X30,0X00,0X10,0X00,
+0X10,0X41,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X18,0XC3,
+0X08,0XA1,0X00,0X40,0X00,0X20,0X00,0X40,0X10,0X81,0X21,0X04,0X21,0X24,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X20,0XC3,0X18,0X82,0X10,0X21,0X10,0X00,0X08,0X00,0X08,0X00,0X28,0X01,
+0X81,0X89,0XA1,0X69,0XB1,0X29,0XB9,0X09,0XB1,0X09,0XA9,0X29,0X99,0X89,0X48,0X43,
+0X10,0X00,0X10,0X41,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X18,0XE3,0X10,0XC1,0X00,0X40,0X00,0X40,
+0X09,0X40,0X2A,0X23,0X01,0X00,0X21,0XA3,0X00,0X20,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X20,0XE4,
+0X10,0X61,0X08,0X00,0X18,0X00,0X20,0X00,0X28,0X00,0X28,0X00,0X18,0X00,0X48,0X64,
+0X99,0X89,0XA9,0X49,0XB9,0X09,0XC0,0XE9,0XB8,0XE9,0XB9,0X09,0XB1,0X09,0X99,0X69,
+0X38,0X02,0X08,0X00,0X08,0X00,0X00,0X00,0X08,0X21,0X10,0X82,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X19,0X03,0X00,0X60,0X00,0X60,0X32,0XE4,0X43,0XA5,
+0X5C,0XA8,0X75,0XAC,0X64,0XE9,0X5C,0X29,0X00,0X40,0X10,0XA1,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X20,0XE4,0X10,0X00,
+0X18,0X00,0X38,0X02,0X70,0XE6,0X91,0X89,0X99,0X89,0X91,0XA9,0X71,0X27,0X30,0X00,
+0X60,0X23,0X89,0X07,0XA1,0X69,0XA9,0X29,0XB1,0X29,0XB1,0X29,0XA9,0X29,0X99,0X89,
+0X48,0XC4,0X10,0X00,0X30,0X22,0X28,0X01,0X18,0X00,0X10,0X00,0X08,0X00,0X18,0X82,
+0X21,0X04,0X21,0X24,0X18,0XE3,0X00,0X40,0X09,0X40,0X5C,0X29,0X75,0XAB,0X6D,0XCA,
+0X6D,0XC9,0X6D,0XE9,0X6D,0XEA,0X6D,0X4A,0X3A,0XC6,0X00,0X60,0X21,0X23,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,
+0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X10,0X21,0X18,0X00,
+0X70,0XA5,0XA1,0X49,0XB1,0X29,0XB1,0X29,0XB1,0X29,0XA9,0X29,0X99,0X89,0X48,0X02,
+0X20,0X00,0X18,0X00,0X20,0X00,0X38,0X02,0X58,0X44,0X60,0X64,0X58,0X85,0X38,0X22,
+0X10,0X00,0X18,0X00,0X89,0XA9,0XA1,0X69,0X99,0X49,0X68,0XA5,0X28,0X00,0X10,0X00,
+0X20,0XA3,0X19,0X03,0X00,0X60,0X19,0XE2,0X54,0X47,0X75,0XCB,0X6D,0XCA,0X6D,0XE9,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X75,0XAB,0X32,0XE5,0X00,0X40,0X21,0X23,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X18,0X82,0X18,0X00,0X60,0XA5,
+0XA9,0X49,0XB8,0XE9,0XC0,0XE9,0XC0,0XC9,0XC0,0XE9,0XB9,0X09,0XA1,0X69,0X40,0X02,
+0X10,0X00,0X08,0X00,0X18,0X00,0X20,0X00,0X40,0X02,0X48,0X02,0X38,0X00,0X28,0X00,
+0X18,0X00,0X20,0X00,0X70,0X65,0XA9,0X49,0XB1,0X09,0XA9,0X49,0X89,0X69,0X30,0X01,
+0X10,0X00,0X00,0X60,0X00,0XA0,0X64,0X8A,0X75,0XCB,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,
+0X6D,0XE9,0X6D,0XE9,0X65,0XE9,0X6D,0XCA,0X64,0X8A,0X00,0X40,0X19,0X23,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X18,0XE3,0X10,0X00,0X38,0X01,0X99,0X69,
+0XB1,0X09,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XB1,0X29,0X89,0X69,0X28,0X00,
+0X10,0X00,0X18,0X00,0X58,0X24,0X99,0X49,0XA9,0X29,0XA9,0X29,0XA9,0X29,0X91,0X08,
+0X50,0X23,0X28,0X00,0X30,0X00,0X81,0X48,0XB1,0X29,0XB8,0XE9,0XB1,0X29,0X81,0X07,
+0X18,0X00,0X00,0X20,0X53,0XE7,0X75,0XCB,0X6D,0XEA,0X6D,0XE9,0X6E,0X09,0X6D,0XE9,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0XCA,0X5C,0X89,0X01,0X00,0X08,0XA1,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X10,0X61,0X10,0X00,0X68,0X85,0XA9,0X49,
+0XB9,0X09,0XC0,0XE9,0XC0,0XE9,0XB8,0XE9,0XB9,0X09,0XA1,0X49,0X58,0X84,0X18,0X00,
+0X18,0X00,0X48,0X64,0XA1,0X69,0XB1,0X09,0XB8,0XE9,0XC0,0XE9,0XC0,0XE9,0XB9,0X09,
+0XA1,0X69,0X70,0XA6,0X28,0X00,0X40,0X01,0XA1,0X49,0XB9,0X09,0XB8,0XE9,0XA1,0X49,
+0X38,0X42,0X08,0X60,0X5C,0XA8,0X6D,0XC9,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,
+0X6D,0XE9,0X6D,0XE9,0X6E,0X09,0X6D,0XCA,0X7D,0X8C,0X09,0X60,0X08,0XC1,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X18,0XC3,0X00,0X00,0X18,0X00,0X80,0XE7,0XB1,0X29,
+0XB9,0X09,0XC0,0XC9,0XC0,0XE9,0XB9,0X09,0XA1,0X49,0X68,0XA6,0X18,0X00,0X10,0X00,
+0X28,0X00,0X89,0X69,0XB1,0X29,0XB8,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XB8,0XE9,
+0XB9,0X09,0XA1,0X49,0X68,0X85,0X30,0X00,0X58,0X03,0XA1,0X69,0XB1,0X09,0XA9,0X49,
+0X50,0XA3,0X4A,0X85,0X7D,0X8B,0X6D,0XE9,0X6D,0XE9,0X6E,0X09,0X6D,0XE9,0X6D,0XE9,
+0X55,0X06,0X6D,0XE9,0X6D,0XE9,0X6D,0XCA,0X64,0XEA,0X09,0X60,0X08,0XA0,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X08,0X21,0X00,0X00,0X10,0X00,0X70,0XC6,0XA9,0X49,
+0XB1,0X29,0XB1,0X29,0XA9,0X29,0XA1,0X69,0X70,0XA6,0X20,0X00,0X08,0X00,0X10,0X00,
+0X40,0X02,0X99,0X69,0XB9,0X09,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XC9,
+0XC0,0XE9,0XB1,0X09,0X99,0X89,0X38,0X00,0X28,0X00,0X58,0X84,0XA1,0X49,0XA1,0X69,
+0X69,0X65,0X52,0X65,0X7D,0X8B,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X65,0X88,
+0X55,0X06,0X6D,0XE9,0X6D,0XE9,0X75,0XEA,0X75,0X2C,0X00,0XA0,0X10,0XC1,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X18,0XE4,0X00,0X00,0X00,0X00,0X10,0X00,0X40,0X22,0X81,0X89,
+0X91,0XA9,0X89,0X69,0X68,0XC6,0X40,0X02,0X20,0X00,0X18,0X00,0X08,0X00,0X10,0X00,
+0X40,0X02,0XA1,0X69,0XB9,0X09,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,
+0XC0,0XC9,0XB9,0X09,0XA1,0X49,0X58,0X24,0X18,0X00,0X18,0X00,0X60,0XA5,0X89,0XC9,
+0X61,0X66,0X31,0X62,0X7D,0X8B,0X6D,0XE9,0X6E,0X09,0X6D,0XE9,0X6D,0XCA,0X2B,0XA2,
+0X6D,0XC9,0X6D,0XE9,0X6D,0XE9,0X75,0XCA,0X64,0X8A,0X00,0XE0,0X10,0XE2,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X20,0XE3,0X10,0X00,0X10,0X00,0X30,0X42,0X20,0X00,0X18,0X00,0X20,0X00,
+0X28,0X00,0X28,0X00,0X30,0X00,0X40,0X01,0X50,0X64,0X48,0X64,0X30,0X01,0X20,0X00,
+0X40,0X00,0X99,0X69,0XB1,0X09,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,
+0XC0,0XC9,0XB9,0X09,0XA9,0X29,0X68,0X44,0X18,0X00,0X18,0X00,0X30,0X00,0X48,0X02,
+0X40,0X63,0X10,0X40,0X75,0X2B,0X6D,0XCA,0X6D,0XCA,0X6D,0XCA,0X3B,0XE4,0X54,0XE7,
+0X6D,0XE9,0X6D,0XE9,0X6E,0X09,0X75,0XCB,0X2A,0XA3,0X00,0X40,0X19,0X23,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X18,0X42,0X20,0X00,0X60,0XC5,0X99,0X89,0X70,0XA5,0X18,0X00,0X10,0X00,
+0X18,0X00,0X30,0X00,0X80,0XC7,0XA9,0X49,0XA9,0X29,0XA9,0X49,0XA1,0X49,0X88,0XC7,
+0X40,0X00,0X80,0XE7,0XB1,0X09,0XC0,0XE9,0XC0,0XC9,0XC0,0XE9,0XC0,0XC9,0XC0,0XE9,
+0XC0,0XE9,0XB9,0X09,0XA9,0X49,0X68,0X24,0X30,0X00,0X60,0XA5,0X99,0X29,0X70,0X65,
+0X20,0X00,0X00,0X00,0X3A,0XC5,0X7D,0X8C,0X75,0XAB,0X54,0XC7,0X33,0XA2,0X6D,0XCA,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X75,0XAB,0X43,0X27,0X00,0X20,0X21,0X23,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X18,0XE3,0X10,0X00,0X58,0X44,0XA1,0X69,0XB1,0X29,0XA1,0X69,0X28,0X01,0X10,0X00,
+0X20,0X00,0X79,0X28,0XA9,0X29,0XB8,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XB1,0X29,
+0X89,0X07,0X50,0X01,0XA9,0X49,0XB1,0X09,0XB9,0X09,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,
+0XC0,0XE9,0XB1,0X09,0X99,0X69,0X50,0X02,0X60,0X03,0XA1,0X69,0XB1,0X29,0XA1,0X49,
+0X50,0X84,0X10,0X00,0X00,0X40,0X22,0X43,0X53,0XE8,0X0A,0X00,0X75,0XCB,0X6D,0XE9,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XCA,0X5C,0XA9,0X00,0X60,0X19,0X03,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X10,0X61,0X18,0X00,0X99,0X49,0XB9,0X09,0XB8,0XE9,0XA9,0X49,0X50,0X64,0X20,0X00,
+0X68,0X44,0XA9,0X49,0XB9,0X09,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XB9,0X09,
+0XA9,0X49,0X60,0X03,0X58,0X03,0X91,0X49,0XB1,0X29,0XB8,0XE9,0XC0,0XE9,0XC0,0XE9,
+0XB9,0X09,0XA1,0X49,0X60,0XC6,0X30,0X00,0X99,0X08,0XB1,0X09,0XB8,0XE9,0XB1,0X29,
+0X99,0X89,0X30,0X00,0X08,0X00,0X00,0X40,0X00,0X40,0X53,0XC8,0X75,0XAB,0X6D,0XE9,
+0X6D,0XE9,0X75,0XCA,0X7D,0X8C,0X22,0X43,0X00,0X40,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X10,0X01,0X40,0X23,0XA9,0X49,0XC0,0XE9,0XC0,0XE9,0XB1,0X29,0X60,0XA5,0X30,0X00,
+0X99,0X08,0XB9,0X09,0XC0,0XE9,0XC0,0XE9,0XC0,0XC9,0XC0,0XE9,0XC0,0XC9,0XB8,0XE9,
+0XB1,0X09,0X88,0XC7,0X28,0X00,0X30,0X00,0X70,0XA6,0XA1,0X69,0XA1,0X49,0XA1,0X49,
+0X99,0X49,0X60,0X64,0X20,0X00,0X28,0X00,0XA9,0X49,0XC0,0XE9,0XC0,0XE9,0XB9,0X09,
+0XA1,0X49,0X58,0X44,0X10,0X00,0X00,0X00,0X00,0X20,0X09,0X40,0X6C,0XCB,0X75,0XAC,
+0X75,0XAC,0X4C,0X07,0X09,0X40,0X00,0X60,0X18,0XE2,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X28,0XE4,
+0X10,0X00,0X50,0X84,0XA9,0X49,0XC0,0XE9,0XC0,0XE9,0XB1,0X29,0X71,0X07,0X38,0X00,
+0XA9,0X29,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XC9,0XC0,0XC9,0XC0,0XC9,
+0XB8,0XE9,0XA1,0X49,0X20,0X00,0X08,0X00,0X10,0X00,0X18,0X00,0X28,0X01,0X28,0X01,
+0X18,0X00,0X10,0X00,0X10,0X00,0X38,0X02,0XA9,0X49,0XC0,0XE9,0XC0,0XC9,0XB8,0XE9,
+0XA9,0X49,0X60,0X44,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X40,0X00,0X40,
+0X00,0X40,0X00,0X40,0X08,0XA0,0X19,0X03,0X21,0X23,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X29,0X04,
+0X10,0X00,0X58,0XA4,0XA9,0X29,0XC0,0XE9,0XC0,0XE9,0XB1,0X29,0X71,0X07,0X38,0X00,
+0XA9,0X29,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XC9,0XC0,0XE9,0XC0,0XC9,0XC0,0XE9,
+0XB8,0XE9,0XA1,0X49,0X18,0X00,0X08,0X00,0X10,0X00,0X18,0X00,0X20,0X00,0X20,0X00,
+0X18,0X00,0X10,0X00,0X10,0X00,0X38,0X02,0XA9,0X49,0XC0,0XE9,0XC0,0XC9,0XB8,0XE9,
+0XA9,0X29,0X60,0X64,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X40,0X00,0X40,
+0X00,0X40,0X00,0X40,0X00,0X80,0X18,0XE3,0X21,0X23,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X10,0X21,0X38,0X22,0XA9,0X49,0XC0,0XE9,0XC0,0XE9,0XB1,0X29,0X71,0X27,0X30,0X00,
+0X98,0XE8,0XB8,0XE9,0XB8,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XB8,0XE9,
+0XB1,0X09,0X88,0XC7,0X20,0X00,0X20,0X00,0X50,0X03,0X89,0X07,0XA1,0X49,0XA1,0X4A,
+0X99,0X29,0X68,0X85,0X28,0X00,0X38,0X01,0XA9,0X29,0XC0,0XE9,0XC0,0XE9,0XB8,0XE9,
+0XA9,0X49,0X58,0X23,0X10,0X00,0X00,0X00,0X00,0X20,0X09,0X40,0X6C,0XCA,0X75,0XAC,
+0X75,0X8C,0X4B,0XE7,0X09,0X40,0X00,0X40,0X18,0XE2,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X10,0X61,0X18,0X00,0X99,0X49,0XB1,0X09,0XC1,0X09,0XA9,0X29,0X58,0X84,0X28,0X00,
+0X70,0X65,0XA9,0X49,0XB9,0X09,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XB9,0X09,
+0XA9,0X49,0X68,0X04,0X38,0X00,0X79,0X27,0XA1,0X49,0XB1,0X09,0XC0,0XE9,0XC0,0XE9,
+0XB9,0X09,0XA9,0X49,0X81,0X28,0X38,0X00,0XA1,0X09,0XB9,0X09,0XB8,0XE9,0XB1,0X29,
+0X99,0X89,0X30,0X00,0X08,0X00,0X00,0X20,0X00,0X40,0X53,0XC8,0X75,0XAB,0X6D,0XE9,
+0X6D,0XE9,0X75,0XCA,0X7D,0X8C,0X22,0X22,0X00,0X40,0X21,0X24,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X20,0XE3,0X10,0X00,0X58,0X44,0XA1,0X49,0XB1,0X09,0XA9,0X49,0X40,0X22,0X10,0X00,
+0X28,0X00,0X89,0X69,0XB1,0X29,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XB1,0X29,
+0X81,0X07,0X40,0X00,0X90,0XE7,0XA9,0X29,0XB9,0X09,0XB8,0XE9,0XC0,0XE9,0XC0,0XE9,
+0XC0,0XE9,0XB9,0X09,0XA1,0X49,0X70,0X24,0X80,0X65,0XA1,0X49,0XB1,0X09,0XA1,0X49,
+0X58,0XC5,0X10,0X00,0X00,0X20,0X22,0X23,0X53,0XE8,0X01,0XE0,0X75,0XCB,0X6D,0XEA,
+0X6D,0XC9,0X6D,0XE9,0X75,0XCA,0X64,0XA9,0X00,0X40,0X10,0XC2,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X18,0X61,0X20,0X00,0X68,0XC6,0X99,0X69,0X89,0X28,0X20,0X00,0X18,0X00,
+0X20,0X00,0X40,0X01,0X99,0X08,0XB1,0X29,0XB1,0X29,0XA9,0X29,0XA9,0X49,0X89,0X07,
+0X38,0X00,0X60,0X64,0XA9,0X29,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XC9,0XC0,0XE9,
+0XC0,0XE9,0XB8,0XE9,0XB1,0X09,0X90,0XA7,0X40,0X00,0X79,0X27,0XA1,0X69,0X70,0X65,
+0X20,0X00,0X00,0X00,0X3A,0XC5,0X7D,0X8C,0X75,0XAB,0X54,0XC7,0X2B,0XA2,0X6D,0XCA,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X75,0XAB,0X43,0X27,0X00,0X40,0X19,0X23,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X18,0X41,0X10,0X00,0X30,0X22,0X28,0X01,0X28,0X00,0X40,0X02,
+0X58,0X24,0X50,0X02,0X48,0X00,0X58,0X02,0X60,0X64,0X50,0X84,0X38,0X22,0X20,0X00,
+0X28,0X00,0X89,0X48,0XB1,0X09,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,
+0XC0,0XE9,0XB8,0XE9,0XB1,0X09,0X88,0XC7,0X20,0X00,0X18,0X00,0X30,0X00,0X48,0X02,
+0X30,0X42,0X08,0X60,0X75,0X2B,0X6D,0XCA,0X6D,0XEA,0X6D,0XEA,0X3B,0XE3,0X54,0XE7,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X75,0XCB,0X32,0XE4,0X00,0X40,0X19,0X23,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X9C,0XF3,0XCE,0X59,0XCE,0X59,0XCE,0X59,0XCE,0X59,0XC6,0X38,0XCE,0X59,0XCE,0X59,
+0X73,0XAE,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X18,0XE3,0X00,0X00,0X00,0X00,0X10,0X00,0X60,0XA5,0X91,0X89,
+0XA1,0X69,0XA1,0X49,0X99,0X69,0X70,0XA6,0X38,0X00,0X20,0X00,0X10,0X00,0X10,0X00,
+0X28,0X00,0X91,0X89,0XB1,0X29,0XC0,0XC9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,
+0XC0,0XE9,0XB8,0XE9,0XB1,0X29,0X80,0XC7,0X20,0X00,0X18,0X00,0X68,0XC5,0X89,0XC9,
+0X40,0XE3,0X29,0XA2,0X7D,0XAB,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0XCA,0X2B,0XA2,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0XCA,0X64,0X8A,0X00,0XE0,0X10,0XE2,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X9C,0XF3,0XCE,0X59,0XCE,0X59,0XF7,0X9E,0XE7,0X1C,0XCE,0X59,0XCE,0X59,0XF7,0X9E,
+0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X08,0X61,0X00,0X00,0X18,0X00,0X80,0XE7,0XA9,0X49,
+0XB1,0X09,0XB9,0X09,0XB9,0X09,0XB1,0X29,0X99,0X29,0X58,0X03,0X18,0X00,0X10,0X00,
+0X28,0X00,0X91,0X89,0XB1,0X29,0XC0,0XE9,0XC0,0XC9,0XC0,0XE9,0XC0,0XC9,0XC0,0XC9,
+0XC0,0XE9,0XB9,0X09,0XA1,0X49,0X60,0X03,0X30,0X00,0X68,0XA5,0XA9,0X49,0XA1,0X69,
+0X48,0XC3,0X4A,0X85,0X7D,0XAB,0X65,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0XEA,0X65,0X88,
+0X54,0XE6,0X6D,0XE9,0X6D,0XE9,0X6D,0XCA,0X75,0X2B,0X00,0XA0,0X08,0XC1,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0XCE,0X59,0X94,0X92,0X21,0X24,0X21,0X04,0XCE,0X59,
+0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X18,0XE3,0X00,0X00,0X18,0X00,0X80,0XE7,0XB1,0X09,
+0XB8,0XE9,0XC0,0XE9,0XC0,0XE9,0XB8,0XE9,0XB1,0X09,0XA1,0X69,0X48,0X23,0X20,0X00,
+0X20,0X00,0X79,0X27,0XA9,0X49,0XB8,0XE9,0XC0,0XE9,0XC0,0XC9,0XC0,0XE9,0XC0,0XE9,
+0XB9,0X09,0XA9,0X29,0X89,0X28,0X40,0X00,0X60,0X03,0XA1,0X69,0XB9,0X09,0XA9,0X49,
+0X40,0X82,0X4A,0XA5,0X7D,0X8B,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,
+0X54,0XE6,0X6D,0XE9,0X6D,0XE9,0X6D,0XCA,0X6C,0XEA,0X09,0X40,0X08,0XA0,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0XCE,0X59,0X94,0X92,0X21,0X04,0X21,0X24,0XCE,0X59,
+0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X10,0X82,0X10,0X00,0X70,0X85,0XA9,0X29,
+0XB8,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XB1,0X29,0XA1,0X69,0X40,0X01,
+0X18,0X00,0X38,0X02,0XA1,0X69,0XB9,0X09,0XC0,0XE9,0XC0,0XC9,0XC0,0XE9,0XB8,0XE9,
+0XA9,0X29,0X91,0X48,0X48,0X01,0X48,0X02,0XA9,0X49,0XB1,0X09,0XB8,0XE9,0XA1,0X69,
+0X30,0X01,0X00,0X60,0X5C,0XA8,0X6D,0XC9,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X75,0XCA,0X7D,0X8C,0X09,0X40,0X08,0XC1,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0XAD,0X55,0XCE,0X59,0X31,0X86,0X39,0XE7,0XF7,0X9E,
+0X73,0XAE,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X10,0X00,0X40,0X02,0XA1,0X69,
+0XB1,0X09,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XC9,0XB9,0X09,0XB1,0X29,0X80,0XE7,
+0X18,0X00,0X10,0X00,0X50,0X02,0X99,0X29,0XA9,0X29,0XB1,0X29,0XB1,0X29,0XA1,0X49,
+0X70,0X85,0X38,0X00,0X38,0X00,0X91,0X49,0XB1,0X09,0XB9,0X09,0XA9,0X29,0X78,0XE7,
+0X18,0X00,0X00,0X20,0X53,0XE7,0X75,0XAB,0X6D,0XEA,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0XCA,0X5C,0X89,0X01,0X00,0X08,0XC1,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X4A,0X69,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0XD6,0XBA,
+0X29,0X65,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X18,0XA3,0X18,0X00,0X58,0XA5,
+0XA1,0X49,0XB8,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XC0,0XE9,0XB8,0XE9,0XA1,0X69,
+0X18,0X00,0X08,0X00,0X18,0X00,0X28,0X00,0X48,0X02,0X48,0X02,0X48,0X01,0X30,0X00,
+0X20,0X00,0X28,0X00,0X80,0XA6,0XA9,0X29,0XB9,0X09,0XA9,0X29,0X79,0X27,0X28,0X00,
+0X10,0X00,0X00,0X60,0X00,0XA0,0X6C,0XEB,0X75,0XCA,0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X75,0XCA,0X64,0X8A,0X00,0X60,0X19,0X23,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X39,0XE7,0X84,0X10,0X73,0XAE,0X31,0X86,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X10,0X41,0X18,0X00,
+0X68,0X85,0XA1,0X69,0XA9,0X29,0XB1,0X09,0XB1,0X09,0XB1,0X09,0XB1,0X29,0X99,0X69,
+0X28,0X00,0X18,0X00,0X30,0X01,0X48,0X43,0X58,0X84,0X60,0X64,0X60,0X64,0X50,0X84,
+0X20,0X01,0X28,0X01,0X91,0XAA,0XA1,0X49,0XA1,0X69,0X70,0XA6,0X20,0X00,0X10,0X00,
+0X20,0XC3,0X19,0X03,0X00,0X80,0X19,0XE2,0X54,0X47,0X75,0XCB,0X6D,0XCA,0X6D,0XE9,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X75,0XAB,0X32,0XE5,0X00,0X60,0X19,0X23,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X4A,0X69,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X29,0X65,0X39,0XE7,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X20,0XE4,0X10,0X21,
+0X18,0X00,0X38,0X02,0X70,0XE6,0X91,0X89,0X99,0X89,0X91,0X89,0X70,0XC6,0X50,0X02,
+0X68,0X44,0X91,0X08,0XA9,0X49,0XA9,0X29,0XB1,0X29,0XB1,0X29,0XB1,0X29,0X99,0X69,
+0X69,0X47,0X20,0X00,0X30,0X02,0X30,0X02,0X18,0X00,0X10,0X00,0X10,0X00,0X20,0XC3,
+0X21,0X04,0X21,0X24,0X18,0XE3,0X00,0X60,0X09,0X40,0X5C,0X29,0X75,0XAB,0X75,0XCA,
+0X6D,0XE9,0X6D,0XE9,0X6D,0XE9,0X6D,0X6A,0X3A,0XC5,0X00,0X80,0X19,0X23,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X5A,0XCB,0XE7,0X1C,
+0X73,0XAE,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X24,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X10,0X62,0X08,0X00,0X18,0X00,0X20,0X00,0X28,0X00,0X20,0X00,0X20,0X00,0X50,0X64,
+0X99,0X69,0XA9,0X29,0XB9,0X09,0XB8,0XE9,0XB8,0XE9,0XB9,0X09,0XB1,0X09,0XA1,0X69,
+0X40,0X22,0X10,0X00,0X08,0X00,0X08,0X00,0X08,0X41,0X10,0XA2,0X18,0XE3,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X23,0X00,0X40,0X00,0X60,0X32,0XE4,0X43,0XA5,
+0X5C,0XC8,0X75,0XAB,0X6D,0X4A,0X5C,0X28,0X00,0X40,0X10,0XC2,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X39,0XE7,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X20,0XE4,0X18,0X82,0X18,0X41,0X10,0X00,0X08,0X00,0X08,0X00,0X20,0X00,
+0X79,0X27,0XA1,0X69,0XA9,0X29,0XB1,0X09,0XB1,0X29,0XA9,0X49,0X91,0X69,0X48,0X43,
+0X10,0X00,0X18,0X62,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X10,0XE2,0X00,0X60,0X00,0X40,
+0X09,0X40,0X2A,0X23,0X00,0XE0,0X21,0XC3,0X00,0X20,0X21,0X24,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X4A,0X69,0XAD,0X75,0XCE,0X59,0X84,0X10,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X18,0XC3,0X10,0X62,0X08,0X00,
+0X20,0X00,0X50,0X23,0X70,0X85,0X80,0XE7,0X80,0XE7,0X58,0X24,0X30,0X00,0X10,0X00,
+0X10,0X41,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X18,0XE3,
+0X08,0XA1,0X00,0X60,0X00,0X60,0X08,0X60,0X10,0XA2,0X21,0X24,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X4A,0X69,0XFF,0XFF,0XAD,0X75,0X94,0X92,0XE7,0X1C,0XBD,0XD7,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X20,0XC3,
+0X10,0X01,0X10,0X00,0X10,0X00,0X18,0X00,0X10,0X00,0X10,0X00,0X10,0X00,0X18,0X82,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X94,0X92,0X94,0X92,0X21,0X04,0X21,0X24,0X31,0X86,0XF7,0X9E,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X18,0XE3,0X10,0XA3,0X10,0X82,0X10,0XA3,0X18,0XC3,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XBD,0XD7,0X73,0XAE,0X21,0X24,0X21,0X04,0X21,0X04,0XE7,0X1C,0X4A,0X69,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X73,0XAE,0XCE,0X59,0X21,0X04,0X21,0X24,0X5A,0XCB,0XE7,0X1C,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X4A,0X69,0X21,0X04,0X21,0X04,0X21,0X04,0X4A,0X69,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X4A,0X69,0XAD,0X75,0XCE,0X59,0X84,0X10,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X5A,0XCB,0XFF,0XFF,
+0XFF,0XFF,0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X4A,0X69,0XFF,0XFF,0XAD,0X75,0X94,0X92,0XE7,0X1C,0XBD,0XD7,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X5A,0XCB,0XFF,0XFF,
+0XFF,0XFF,0X5A,0XCB,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X94,0X92,0X94,0X92,0X21,0X04,0X21,0X04,0X31,0X86,0XF7,0X9E,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X5A,0XCB,0XFF,0XFF,
+0XFF,0XFF,0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XAD,0X75,0X63,0X2C,0X21,0X04,0X21,0X24,0X21,0X04,0XD6,0XBA,0X39,0XE7,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCE,0X59,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X84,0X10,0XD6,0XBA,0X39,0XE7,0X21,0X04,0X84,0X10,0XF7,0X9E,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCE,0X59,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0XBD,0XD7,0XFF,0XFF,0XFF,0XFF,0XF7,0X9E,0X5A,0XCB,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X9C,0XF3,0XCE,0X59,0XCE,0X59,0XD6,0XBA,0XFF,0XFF,
+0XFF,0XFF,0XD6,0XBA,0XCE,0X59,0XCE,0X59,0X9C,0XF3,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X39,0XE7,0X5A,0XCB,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X5A,0XCB,0XFF,0XFF,
+0XFF,0XFF,0X5A,0XCB,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X5A,0XCB,0XFF,0XFF,
+0XFF,0XFF,0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X4A,0X69,0XCE,0X59,
+0XCE,0X59,0X4A,0X69,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0XCE,0X59,0X5A,0XCB,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCE,0X59,
+0X31,0X86,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X4A,0X49,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0XD6,0XBA,0X84,0X10,0XC6,0X38,
+0X84,0X10,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X5A,0XCB,0X31,0X86,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X73,0XAE,0X39,0XE7,0X9C,0XF3,
+0X73,0XAE,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X84,0X10,0XF7,0X9E,0X63,0X2C,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X84,0X10,0XE7,0X1C,0XFF,0XFF,0XBD,0XD7,0X39,0XE7,0X21,0X04,0X31,0X86,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XC6,0X38,0XE7,0X1C,0XCE,0X59,0X39,0XE7,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X63,0X2C,0XF7,0X9E,0X73,0XAE,0X5A,0XCB,0XBD,0XD7,0XD6,0XBA,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XFF,0XFF,0XE7,0X1C,0XD6,0XBA,0XF7,0X9E,0X84,0X10,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X9C,0XF3,0X73,0XAE,0X21,0X04,0X21,0X04,0X21,0X04,0XE7,0X1C,0X31,0X86,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD6,0XBA,0XE7,0X1C,0XCE,0X59,
+0X4A,0X69,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X9C,0XF3,0X73,0XAE,0X21,0X04,0X21,0X04,0X21,0X04,0XE7,0X1C,0X31,0X86,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0X1C,0XCE,0X59,
+0XFF,0XFF,0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X63,0X2C,0XF7,0X9E,0X73,0XAE,0X5A,0XCB,0XBD,0XD7,0XD6,0XBA,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X73,0XAE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XD6,0XBA,0XD6,0XBA,0XE7,0X1C,0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X84,0X10,0XE7,0X1C,0XFF,0XFF,0XBD,0XD7,0X39,0XE7,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X5A,0XCB,0XE7,0X1C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XF7,0X9E,0XD6,0XBA,0XF7,0X9E,0X94,0X92,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD6,0XBA,0X9C,0XF3,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X5A,0XCB,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0XCE,0X59,0XFF,0XFF,0XD6,0XBA,0X94,0X92,0XF7,0X9E,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCE,0X59,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X4A,0X69,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X94,0X92,0XBD,0XD7,0X31,0X86,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X9C,0XF3,0XC6,0X38,0X9C,0XF3,0X21,0X04,0X39,0XE7,
+0XBD,0XD7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC6,0X38,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0XFF,0XFF,0X39,0XE7,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X5A,0XCB,0X94,0X92,0XCE,0X59,0XCE,0X59,0XD6,0XBA,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCE,0X59,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCE,0X59,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X63,0X2C,0XD6,0XBA,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCE,0X59,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XE7,0X3C,0XBD,0XD7,0XBD,0XD7,0XBD,0XD7,0XCE,0X59,0XCE,0X59,
+0X9C,0XF3,0X84,0X10,0X5A,0XCB,0X31,0X86,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD6,0XBA,0X9C,0XF3,
+0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0XCE,0X59,
+0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0X5A,0XCB,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0XCE,0X59,
+0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X6B,0X4D,0XD6,0XBA,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X73,0XAE,0X94,0X92,0X94,0X92,0X94,0X92,0X94,0X92,0X94,0X92,0X94,0X92,0XE7,0X1C,
+0X94,0X92,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X31,0X86,0X73,0XAE,0XAD,0X75,0XF7,0X9E,0XFF,0XFF,
+0XFF,0XFF,0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X84,0X30,0XFF,0XFF,
+0XF7,0X9E,0X39,0XE7,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0XCE,0X59,
+0X94,0X92,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X5A,0XCB,0X5A,0XCB,0X63,0X2C,0XF7,0X9E,
+0XFF,0XFF,0X4A,0X69,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0XCE,0X59,
+0X94,0X92,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X73,0XAE,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD6,0XBA,
+0XE7,0X1C,0X73,0XAE,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X73,0XAE,
+0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X4A,0X69,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0X73,0XAE,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X9C,0XF3,0XCE,0X59,0XC6,0X38,0XCE,0X59,0XCE,0X59,0XCE,0X59,0X4A,0X69,0X9C,0XF3,
+0X4A,0X49,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XE7,0X1C,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X73,0XAE,0X94,0X92,0X94,0X92,0X94,0X92,0X94,0X92,0X94,0X92,0X39,0XE7,0X9C,0XF3,
+0X4A,0X69,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X8C,0X71,0XFF,0XFF,0XFF,0XFF,0X94,0X92,0X21,0X24,0X39,0XE7,0XD6,0XBA,
+0XFF,0XFF,0XFF,0XFF,0X39,0XE7,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X5A,0XCB,0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X21,0X04,0X21,0X04,0X39,0XE7,
+0XFF,0XFF,0XFF,0XFF,0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X9C,0XF3,0XCE,0X59,0XCE,0X59,0XCE,0X59,0XC6,0X38,0XCE,0X59,0X4A,0X69,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X5A,0XCB,0XF7,0X9E,0XFF,0XFF,0X5A,0XCB,0X21,0X04,0X21,0X04,0X29,0X65,
+0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X73,0XAE,0X94,0X92,0X94,0X92,0X94,0X92,0XBD,0XD7,0XD6,0XBA,0X39,0XE7,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X5A,0XCB,0XFF,0XFF,0XFF,0XFF,0XF7,0X9E,0X73,0XAE,0X63,0X2C,0XD6,0XBA,
+0XFF,0XFF,0XAD,0X75,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0XD6,0XBA,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X5A,0XCB,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XE7,0X1C,0XAD,0X75,0X73,0XAE,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0XE7,0X1C,0X4A,0X69,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X4A,0X69,0XD6,0XBA,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X9C,0XF3,0XCE,0X59,0XCE,0X59,0XCE,0X59,0XD6,0XBA,0XF7,0X9E,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X39,0XE7,0X9C,0XF3,0XCE,0X59,0XBD,0XD7,0XC6,0X38,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X73,0XAE,0X94,0X92,0X94,0X92,0X94,0X92,0X94,0X92,0X4A,0X69,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X39,0XE7,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X9E,0XBD,0XD7,
+0XCE,0X59,0XCE,0X59,0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X31,0X86,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X31,0X86,0X84,0X30,0X4A,0X49,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X21,0X04,0X4A,0X69,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0XFF,0XFF,0X31,0X86,
+0X21,0X04,0X21,0X04,0X63,0X2C,0XAD,0X75,0XFF,0XFF,0XE7,0X1C,0X4A,0X69,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X94,0X92,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0XBD,0XD7,0XCE,0X59,
+0X9C,0XF3,0XE7,0X1C,0XF7,0X9E,0XAD,0X55,0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X73,0XAE,0XFF,0XFF,0XFF,0XFF,0X94,0X92,0X73,0XAE,0XAD,0X75,0XE7,0X1C,
+0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X31,0X86,0XAD,0X75,
+0XF7,0X9E,0XFF,0XFF,0X94,0X92,0X39,0XE7,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X39,0XE7,0XFF,0XFF,0XFF,0XFF,0X63,0X2C,0X21,0X04,0X21,0X04,0X21,0X04,
+0X31,0X86,0X6B,0X4D,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X31,0X86,0X73,0XAE,0XCE,0X59,0XFF,0XFF,0XBD,0XD7,0X73,0XAE,0X29,0X65,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X5A,0XCB,0XFF,0XFF,0XFF,0XFF,0XD6,0XBA,0X73,0XAE,0X39,0XE7,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X39,0XE7,0X9C,0XF3,0XF7,0X9E,0X5A,0XCB,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X5A,0XCB,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0X1C,
+0XAD,0X75,0XAD,0X55,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X31,0X86,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X52,0XCB,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X29,0X85,0X94,0X92,0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X73,0XAE,0X94,0X92,0X94,0X92,0X94,0X92,0X94,0X92,0XAD,0X55,0XF7,0X9E,0XFF,0XFF,
+0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X28,0XE3,0X30,0XE3,0X38,0XC3,0X7A,0X69,0XB4,0X10,0XE5,0XD7,
+0XFF,0X3C,0XFF,0XBE,0X30,0XE3,0X29,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X29,0X65,0X73,0XAE,0XCE,0X59,0XFF,0XFF,0XCE,0X59,0X73,0XAE,
+0X31,0X86,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X28,0XE3,0X38,0XC3,0X58,0XA2,0X88,0XE3,0XA9,0X45,0XB1,0X24,0XA9,0X25,
+0X99,0X04,0X9A,0X08,0X48,0X82,0X30,0XC3,0X29,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X5A,0XCB,0XAD,0X55,0XF7,0X9E,0XE7,0X1C,0X94,0X92,0X39,0XE7,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X30,0XC3,0X58,0XA2,0X99,0X45,0XB9,0X04,0XC8,0XC3,0XC8,0XC3,0XC8,0XC3,
+0XC0,0XE3,0XB1,0X24,0X89,0X45,0X50,0X82,0X30,0XC3,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X84,0X10,0XE7,0X3C,0XF7,0X9E,0XAD,0X75,0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X40,0XA2,0X91,0X04,0XC0,0XE4,0XC8,0XC3,0XC8,0XC3,0XC8,0XC3,0XC0,0XE3,
+0XC8,0XC3,0XC8,0XC3,0XB8,0XE4,0X91,0X04,0X48,0XA2,0X28,0XE3,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X5A,0XCB,0XAD,0X75,0XF7,0X9E,0XE7,0X1C,0X94,0X92,0X39,0XE7,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X50,0XC3,0XB1,0X24,0XC8,0XC3,0XC0,0XE3,0XB0,0XE4,0X98,0XA3,0X98,0XC3,
+0XA9,0X04,0XB9,0X04,0XC8,0XC3,0XB9,0X04,0X71,0X04,0X38,0XC3,0X29,0X03,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X4A,0X69,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X63,0X2C,0XAD,0X75,0XF7,0X9E,0XFF,0XFF,
+0X84,0X10,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X29,0X03,
+0X38,0XC3,0X69,0X04,0XB9,0X04,0XC0,0XE3,0X99,0X24,0X58,0X61,0X48,0XA2,0X40,0XA2,
+0X50,0X82,0X89,0X04,0XB9,0X04,0XB8,0XE4,0X91,0X45,0X48,0X82,0X30,0XE3,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X28,0XE3,
+0X38,0XC2,0X79,0X24,0XB8,0XE4,0XB9,0X04,0X68,0XA2,0X38,0XA2,0X29,0X04,0X29,0X04,
+0X30,0XE3,0X50,0X82,0XA8,0XE4,0XB9,0X04,0XA1,0X45,0X60,0X82,0X30,0XC3,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X4A,0X69,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,
+0X39,0XE7,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X28,0XE3,
+0X38,0XA3,0X79,0X04,0XB8,0XE4,0XB9,0X04,0X60,0XA2,0X38,0XC3,0X29,0X03,0X21,0X04,
+0X29,0X04,0X40,0XA2,0X88,0XA2,0XB1,0X04,0XA1,0X45,0X68,0XA2,0X30,0XC3,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X29,0X03,
+0X38,0XC3,0X71,0X04,0XB9,0X04,0XB8,0XE4,0X78,0XE3,0X40,0XA2,0X28,0XE3,0X21,0X04,
+0X28,0XE3,0X40,0XA2,0X90,0XA3,0XB1,0X04,0XA9,0X45,0X68,0X82,0X30,0XC3,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0X94,0X92,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X30,0XE3,0X58,0XE3,0XB1,0X04,0XC0,0XC3,0XB1,0X25,0X70,0XC3,0X38,0XC3,0X29,0X04,
+0X38,0XC3,0X60,0XA2,0XB1,0X04,0XC0,0XE4,0XA9,0X25,0X68,0X82,0X30,0XC3,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0XCE,0X59,0X94,0X92,0X94,0X92,0X94,0X92,0X94,0X92,0X94,0X92,0X94,0X92,
+0X5A,0XCB,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X29,0X04,0X40,0XA2,0X99,0X04,0XB9,0X04,0XB1,0X24,0X89,0X04,0X38,0XC3,0X28,0XE3,
+0X40,0XC3,0X89,0X86,0XB8,0XE4,0XC0,0XE4,0XA1,0X65,0X50,0X82,0X30,0XE3,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0X94,0X92,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X38,0XC3,0X68,0XA3,0X99,0X66,0X99,0X66,0X68,0XA3,0X30,0XC3,0X29,0X04,
+0X40,0XA2,0X81,0X45,0XB9,0X04,0XB9,0X04,0X79,0X04,0X38,0XC3,0X28,0XE3,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X30,0XE3,0X50,0X62,0X70,0XA2,0X91,0X25,0X60,0X20,0X48,0X82,0X38,0XA2,
+0X40,0XA2,0X68,0XE3,0XA1,0X45,0X91,0X04,0X48,0XA2,0X28,0XE3,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0XCE,0X59,0X94,0X92,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X38,0XC3,0X60,0X41,0X90,0XC3,0XA0,0XC3,0XA8,0XC3,0X98,0XE4,0X70,0XA3,
+0X48,0X82,0X40,0X82,0X69,0X45,0X48,0XA2,0X30,0XC3,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X40,0XC3,0X99,0X45,0XB1,0X04,0XC1,0X04,0XC0,0XE3,0XB9,0X04,0XA9,0X25,
+0X89,0X45,0X50,0X82,0X38,0XC3,0X30,0XE3,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X29,0X03,
+0X30,0XC3,0X61,0X04,0XB1,0X24,0XC8,0XE3,0XC0,0XE3,0XC0,0XE4,0XC0,0XE3,0XB8,0XE4,
+0XB1,0X04,0X88,0XE4,0X40,0XA2,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X29,0X03,
+0X30,0XC3,0X71,0X04,0XB9,0X04,0XC8,0XC3,0XA8,0XE3,0X90,0X82,0X98,0XA2,0XB1,0X04,
+0XC0,0XE3,0XA9,0X25,0X40,0XA2,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X29,0X03,
+0X30,0XE3,0X60,0XE3,0XB9,0X04,0XB9,0X04,0X60,0X82,0X48,0X82,0X48,0X82,0X70,0XC3,
+0XB9,0X04,0XB1,0X04,0X50,0XE3,0X29,0X03,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X03,
+0X30,0XE3,0X58,0XA3,0XB9,0X04,0XB9,0X04,0X60,0X62,0X40,0XA2,0X40,0XA2,0X58,0X41,
+0XB9,0X04,0XB1,0X04,0X48,0XA3,0X29,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X58,0XC3,0XB9,0X04,0XC0,0XC3,0XA1,0X04,0X70,0X41,0X68,0X20,0X88,0XA2,
+0XC0,0XE4,0XA8,0XE4,0X40,0XA2,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X30,0XE3,0X58,0XC3,0XB1,0X04,0XC8,0XC3,0XB8,0XE4,0XB1,0X04,0XB1,0X24,0XB1,0X04,
+0XC8,0XC3,0XA0,0XE4,0X40,0XA2,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X50,0XC3,0XA9,0X25,0XC8,0XE3,0XC0,0XE3,0XC0,0XE3,0XC8,0XE3,0XC8,0XC3,
+0XD0,0XA3,0XB1,0X24,0X40,0XA2,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X50,0XC3,0XA0,0XC3,0XB8,0X62,0XC0,0X62,0XC8,0XA2,0XD0,0XC3,0XD0,0XC3,
+0XD0,0XA3,0XB1,0X24,0X40,0XA3,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X30,0XE3,0X58,0XC3,0XB1,0X04,0XD0,0XC3,0XC8,0XC3,0XC0,0X82,0XB8,0X62,0XB8,0X62,
+0XB8,0X82,0XA1,0X04,0X40,0XA3,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X50,0XE3,0XA9,0X25,0XC8,0XE3,0XC8,0XC3,0XC8,0XC3,0XC8,0XC3,0XC8,0XC3,
+0XC8,0XC3,0XA1,0X04,0X40,0XA3,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X49,0X04,0X99,0X66,0XB1,0X24,0XB9,0X04,0XC0,0XE3,0XC8,0XC3,0XD0,0XA3,
+0XD0,0XA3,0XB1,0X24,0X40,0XA2,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X29,0X04,0X38,0XC3,0X58,0X62,0X78,0X62,0X88,0XC3,0XA0,0XE3,0XB9,0X04,0XC0,0XE4,
+0XC8,0XC3,0XB1,0X24,0X40,0XA2,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X29,0X04,0X30,0XE3,0X48,0X82,0X50,0X82,0X40,0XA2,0X48,0X82,0X58,0X41,0X99,0X04,
+0XB0,0XC3,0XA1,0X04,0X38,0XA2,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X29,0X04,0X41,0X04,0X71,0X65,0X68,0XE3,0X58,0XC3,0X50,0X82,0X58,0X41,0X88,0XC3,
+0XB9,0X04,0X98,0XC3,0X40,0XA2,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X50,0XE3,0XA1,0X45,0XB9,0X04,0XB9,0X04,0XB1,0X04,0XA8,0XA3,0XB8,0XC3,
+0XC8,0XC3,0XB1,0X24,0X48,0XA2,0X29,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X50,0XC3,0XA9,0X25,0XC8,0XC3,0XC8,0XC3,0XC8,0XC3,0XC8,0XC3,0XC8,0XC3,
+0XC8,0XC3,0XB1,0X24,0X50,0XE3,0X29,0X03,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X29,0X04,0X40,0XE4,0X89,0X65,0XA9,0X45,0XB9,0X04,0XC0,0XE4,0XC8,0XC3,0XC8,0XC3,
+0XC0,0XE3,0XA9,0X45,0X40,0XA2,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X29,0X04,0X38,0XC3,0X58,0X61,0X70,0X41,0X80,0X82,0X98,0XA3,0XB0,0XE3,0XB8,0XE4,
+0XB8,0XE3,0X80,0X62,0X38,0XA2,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X29,0X04,0X38,0XC3,0X60,0X82,0X60,0X21,0X58,0X41,0X58,0X41,0X68,0X00,0X99,0X04,
+0XB1,0X04,0X80,0X62,0X38,0XA2,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X49,0X04,0X91,0X86,0X99,0X45,0X81,0X04,0X78,0XC3,0X70,0X61,0X98,0XC3,
+0XB9,0X04,0XA1,0X24,0X40,0XA2,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X50,0XE3,0XA9,0X45,0XC0,0XE3,0XC0,0XE4,0XB8,0XE4,0XC0,0XE4,0XC0,0XE3,
+0XC8,0XC3,0XB1,0X04,0X50,0XC3,0X29,0X03,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X28,0XE3,0X50,0XE3,0XA1,0X45,0XC1,0X04,0XC0,0XE3,0XC0,0XE3,0XC8,0XC3,0XC8,0XC3,
+0XC8,0XC3,0XA9,0X45,0X50,0XC3,0X29,0X03,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X38,0XE3,0X61,0X04,0X81,0X04,0X91,0X25,0XA1,0X45,0XB1,0X24,0XB1,0X04,
+0XB1,0X25,0X89,0X45,0X38,0XA3,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X28,0XE3,0X30,0XC3,0X40,0XA2,0X48,0X82,0X58,0X61,0X70,0X82,0X78,0XE3,
+0X78,0XE4,0X50,0X82,0X30,0XE3,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X28,0XE4,0X28,0XE4,0X30,0XE3,0X30,0XC3,0X38,0XC3,0X38,0XC3,
+0X30,0XC3,0X30,0XE3,0X29,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X04,
+};
@@ -40,6 +40,7 @@ int EPD_CS_PIN      = 13;
 int EPD_CLK_PIN     = 10;
 int EPD_MOSI_PIN    = 11;
 uint slice_num;
+uint slice_chan;
 /**
  * GPIO read and write
 **/
@@ -66,6 +67,29 @@ void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len)
     spi_write_blocking(SPI_PORT, pData, Len);
 }
 
+/**
+ * PWM
+**/
+void DEV_SET_PWM(uint8_t Value)
+{
+    if(Value > 100) {
+        printf("DEV_SET_PWM Error \r\n");
+    } else {
+        DEV_SET_PWM_Level(Value * (DEV_PWM_TOP / 100));
+    }
+}
+
+void DEV_SET_PWM_Level(UWORD Value)
+{
+#if DEV_BL_PIN >= 0
+    if(Value > DEV_PWM_TOP)
+        Value = DEV_PWM_TOP;
+    pwm_set_chan_level(slice_num, slice_chan, Value);
+#else
+    (void)Value;
+#endif
+}
+
 /**
  * GPIO Mode
 **/
@@ -101,16 +125,36 @@ Info:
 ******************************************************************************/
 UBYTE DEV_Module_Init(void)
 {
-    spi_init(SPI_PORT, 12000 * 1000);
+    spi_init(SPI_PORT, DEV_SPI_BAUD);
     gpio_set_function(EPD_CLK_PIN, GPIO_FUNC_SPI);
     gpio_set_function(EPD_MOSI_PIN, GPIO_FUNC_SPI);
     // GPIO Config
     DEV_GPIO_Init();
+#if DEV_BL_PIN >= 0
+    // PWM Config: backlight at 25 kHz (125 MHz / 5 / 1000), off until set
+    gpio_set_function(DEV_BL_PIN, GPIO_FUNC_PWM);
+    slice_num = pwm_gpio_to_slice_num(DEV_BL_PIN);
+    slice_chan = pwm_gpio_to_channel(DEV_BL_PIN);
+    pwm_set_wrap(slice_num, DEV_PWM_TOP - 1);
+    pwm_set_chan_level(slice_num, slice_chan, 0);
+    pwm_set_clkdiv(slice_num, 5);
+    pwm_set_enabled(slice_num, true);
+#endif
     printf("DEV_Module_Init OK \r\n");
     return 0;
 }
 
 
+/******************************************************************************
+function:	Reprogram the SPI divider after clk_peri has changed
+parameter:
+Info:   clk_peri follows clk_sys, so call this after every system clock change
+******************************************************************************/
+void DEV_Module_ClockChanged(void)
+{
+    spi_set_baudrate(SPI_PORT, DEV_SPI_BAUD);
+}
+
 /******************************************************************************
 function:	Module exits, closes SPI and BCM2835 library
 parameter:
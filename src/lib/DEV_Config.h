@@ -61,13 +61,22 @@
 #define UWORD   uint16_t
 #define UDOUBLE uint32_t
 #define SPI_PORT spi1
+#define DEV_SPI_BAUD (12000 * 1000)
+// Backlight PWM steps; DEV_SET_PWM_Level(DEV_PWM_TOP) is fully on
+#define DEV_PWM_TOP 1000
+// GPIO wired to the panel's BLK pin, for PWM brightness. The stock wiring
+// leaves BLK unconnected, and the module's own pull-up keeps the backlight
+// fully on. Set this only on a board that routes BLK to a free PWM-capable
+// GPIO; while it is -1 the backlight calls change nothing.
+#ifndef DEV_BL_PIN
+#define DEV_BL_PIN -1
+#endif
 /**
  * GPIOI config
 **/
 extern int EPD_RST_PIN;
 extern int EPD_DC_PIN;
 extern int EPD_CS_PIN;
-extern int EPD_BL_PIN;
 extern int EPD_CLK_PIN;
 extern int EPD_MOSI_PIN;
 
@@ -79,9 +88,12 @@ void DEV_SPI_WriteByte(UBYTE Value);
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len);
 void DEV_Delay_ms(UDOUBLE xms);
 
+// Backlight in percent (0-100), or in DEV_PWM_TOP steps
 void DEV_SET_PWM(uint8_t Value);
+void DEV_SET_PWM_Level(UWORD Value);
 
 UBYTE DEV_Module_Init(void);
+void DEV_Module_ClockChanged(void);
 void DEV_Module_Exit(void);
 
 
@@ -1,19 +1,205 @@
 #include "ICM20948.h"
 #include <hardware/gpio.h>
+#include <hardware/timer.h>
+#include "trace.h"
 
 #define I2C_PORT i2c0
 IMU_ST_SENSOR_DATA gstGyroOffset = { 0, 0, 0 };
 
+const ICM20948_ST_CONFIG gstIcm20948LowLatency = {
+  .u8GyroDiv = 3, .u8GyroFs = 3, .u8GyroDlpf = 3,
+  .u16AccelDiv = 3, .u8AccelFs = 1, .u8AccelDlpf = 3,
+};
+const ICM20948_ST_CONFIG gstIcm20948LowNoise = {
+  .u8GyroDiv = 8, .u8GyroFs = 1, .u8GyroDlpf = 5,
+  .u16AccelDiv = 8, .u8AccelFs = 0, .u8AccelDlpf = 5,
+};
+const ICM20948_ST_CONFIG gstIcm20948LowPower = {
+  .u8GyroDiv = 43, .u8GyroFs = 3, .u8GyroDlpf = 6,
+  .u16AccelDiv = 44, .u8AccelFs = 1, .u8AccelDlpf = 6,
+};
+/* The last setting written whole; the sensor's own after a reset until then */
+static ICM20948_ST_CONFIG gstConfig = {
+  .u8GyroDlpf = ICM20948_DLPF_OFF, .u8AccelDlpf = ICM20948_DLPF_OFF,
+};
+
+/* Filter group delay in us for each DLPF setting, the last entry with the
+ * filter off. Estimated from the MPU-9250 figures for similar bandwidths. */
+static const uint16_t gu16GyroDelayUs[ICM20948_DLPF_OFF + 1] = {
+  2900, 3200, 3600, 5400, 9000, 16500, 31000, 1000, 170
+};
+static const uint16_t gu16AccelDelayUs[ICM20948_DLPF_OFF + 1] = {
+  1900, 1900, 2700, 4400, 8000, 15500, 30000, 1400, 500
+};
+
+static ICM20948_ST_BUS_STATS gstBusStats;
+static uint32_t gu32Baud = 400 * 1000;
+static bool     gbBusDown;
+static uint32_t gu32RetryAt;
+static bool     gbBankLost;
+#if ICM20948_FAULT_INJECTION
+static volatile uint16_t gu16Stalls;
+#endif
+
+void icm20948BusInit(uint32_t u32Baud) {
+  gu32Baud = u32Baud;
+  i2c_init(I2C_PORT, u32Baud);
+  gpio_set_function(ICM20948_SDA_PIN, GPIO_FUNC_I2C);
+  gpio_set_function(ICM20948_SCL_PIN, GPIO_FUNC_I2C);
+  gpio_pull_up(ICM20948_SDA_PIN);
+  gpio_pull_up(ICM20948_SCL_PIN);
+}
+
+/* Put the sensor back in bank 0, where every reading is taken: a transfer
+ * cut off between the bank switches in icm20948Configure can leave it in
+ * bank 2, and bank-0 reads would then return plausible garbage. Written
+ * straight to the controller, as the bus has just been reset; if it fails
+ * the bank is written again when the bus is next retried. Returns the
+ * transfer's result. */
+static int I2C_RestoreBank(void) {
+  uint8_t buf[] = { REG_ADD_REG_BANK_SEL, REG_VAL_REG_BANK_0 };
+  int ret = i2c_write_timeout_us(I2C_PORT, I2C_ADD_ICM20948, buf, sizeof(buf), false,
+                                 ICM20948_I2C_TIMEOUT_US);
+  gbBankLost = ret != sizeof(buf);
+  return ret;
+}
+
+/* A slave cut off mid-byte can hold SDA low for good. Clock SCL by hand
+ * until it lets go (nine clocks finish any byte and its ACK), send a STOP,
+ * then reset the controller. Pins are driven open drain: low as an output,
+ * released to the pull-ups as an input. About 100 us at 100 kHz. */
+void icm20948BusRecover(void) {
+  uint8_t i;
+
+  gstBusStats.u32Recoveries++;
+  i2c_deinit(I2C_PORT);
+  gpio_set_function(ICM20948_SDA_PIN, GPIO_FUNC_SIO);
+  gpio_set_function(ICM20948_SCL_PIN, GPIO_FUNC_SIO);
+  gpio_put(ICM20948_SDA_PIN, 0);
+  gpio_put(ICM20948_SCL_PIN, 0);
+  gpio_set_dir(ICM20948_SDA_PIN, GPIO_IN);
+  gpio_set_dir(ICM20948_SCL_PIN, GPIO_IN);
+  busy_wait_us_32(5);
+
+  for (i = 0; i < 9 && !gpio_get(ICM20948_SDA_PIN); i++) {
+    gpio_set_dir(ICM20948_SCL_PIN, GPIO_OUT);
+    busy_wait_us_32(5);
+    gpio_set_dir(ICM20948_SCL_PIN, GPIO_IN);
+    busy_wait_us_32(5);
+  }
+
+  /* STOP: SDA rises while SCL is high */
+  gpio_set_dir(ICM20948_SCL_PIN, GPIO_OUT);
+  gpio_set_dir(ICM20948_SDA_PIN, GPIO_OUT);
+  busy_wait_us_32(5);
+  gpio_set_dir(ICM20948_SCL_PIN, GPIO_IN);
+  busy_wait_us_32(5);
+  gpio_set_dir(ICM20948_SDA_PIN, GPIO_IN);
+  busy_wait_us_32(5);
+
+  icm20948BusInit(gu32Baud);
+  I2C_RestoreBank();
+}
+
+const ICM20948_ST_BUS_STATS *icm20948BusStats(void) {
+  return &gstBusStats;
+}
+
+void icm20948InjectStalls(uint16_t u16Count) {
+#if ICM20948_FAULT_INJECTION
+  gu16Stalls = u16Count;
+#endif
+}
+
+/* Turn a transfer's result into PICO_OK or an error, recovering the bus on
+ * failure */
+static int I2C_Check(int ret, int expected) {
+  if (ret == expected) {
+    return PICO_OK;
+  }
+
+  if (ret == PICO_ERROR_TIMEOUT) {
+    gstBusStats.u32Timeouts++;
+  }
+  else {
+    gstBusStats.u32Errors++;
+  }
+  icm20948BusRecover();
+  gbBusDown   = true;
+  gu32RetryAt = time_us_32() + ICM20948_I2C_RETRY_MS * 1000;
+  return ret < 0 ? ret : PICO_ERROR_GENERIC;
+}
+
+static bool I2C_BusReady(void) {
+  if (gbBusDown) {
+    if ((int32_t)(time_us_32() - gu32RetryAt) < 0) {
+      gstBusStats.u32Skipped++;
+      return false;
+    }
+    gbBusDown = false;
+    if (gbBankLost && I2C_Check(I2C_RestoreBank(), 2) != PICO_OK) {
+      return false;
+    }
+  }
+  return true;
+}
+
+#if ICM20948_FAULT_INJECTION
+static bool I2C_Stall(void) {
+  if (!gu16Stalls) {
+    return false;
+  }
+  gu16Stalls--;
+  busy_wait_us_32(ICM20948_I2C_TIMEOUT_US);
+  return true;
+}
+#endif
+
+static int I2C_Write(const uint8_t *buf, uint8_t len, bool nostop) {
+#if ICM20948_FAULT_INJECTION
+  if (I2C_Stall()) {
+    return I2C_Check(PICO_ERROR_TIMEOUT, len);
+  }
+#endif
+  return I2C_Check(i2c_write_timeout_us(I2C_PORT, I2C_ADD_ICM20948, buf, len, nostop,
+                                        ICM20948_I2C_TIMEOUT_US), len);
+}
+
+static int I2C_Read(uint8_t *buf, uint8_t len) {
+#if ICM20948_FAULT_INJECTION
+  if (I2C_Stall()) {
+    return I2C_Check(PICO_ERROR_TIMEOUT, len);
+  }
+#endif
+  return I2C_Check(i2c_read_timeout_us(I2C_PORT, I2C_ADD_ICM20948, buf, len, false,
+                                       ICM20948_I2C_TIMEOUT_US), len);
+}
+
+int I2C_ReadBytes(uint8_t reg, uint8_t *buf, uint8_t len) {
+  TRACE_SCOPE(TRACE_EV_I2C_READ);
+  if (!I2C_BusReady()) {
+    return PICO_ERROR_TIMEOUT;
+  }
+  int ret = I2C_Write(&reg, 1, true);
+  if (ret == PICO_OK) {
+    ret = I2C_Read(buf, len);
+  }
+  return ret;
+}
+
 char I2C_ReadOneByte(uint8_t reg) {
-  uint8_t buf;
-  i2c_write_blocking(I2C_PORT, I2C_ADD_ICM20948, &reg, 1, true);
-  i2c_read_blocking(I2C_PORT, I2C_ADD_ICM20948, &buf, 1, false);
+  uint8_t buf = 0;
+  I2C_ReadBytes(reg, &buf, 1);
   return buf;
 }
 
-void I2C_WriteOneByte(uint8_t reg, uint8_t value) {
+int I2C_WriteOneByte(uint8_t reg, uint8_t value) {
+  TRACE_SCOPE(TRACE_EV_I2C_WRITE);
   uint8_t buf[] = { reg, value };
-  i2c_write_blocking(I2C_PORT, I2C_ADD_ICM20948, buf, 2, false);
+  if (!I2C_BusReady()) {
+    return PICO_ERROR_TIMEOUT;
+  }
+  return I2C_Write(buf, 2, false);
 }
 
 /******************************************************************************
@@ -226,21 +412,7 @@ void icm20948init() {
   sleep_ms(10);
   I2C_WriteOneByte(REG_ADD_PWR_MIGMT_1, REG_VAL_RUN_MODE);
 
-  /* user bank 2 register */
-  I2C_WriteOneByte(REG_ADD_REG_BANK_SEL, REG_VAL_REG_BANK_2);
-  I2C_WriteOneByte(REG_ADD_GYRO_SMPLRT_DIV, 0x08);
-  I2C_WriteOneByte(REG_ADD_GYRO_CONFIG_1, REG_VAL_BIT_GYRO_DLPCFG_6
-                                            | REG_VAL_BIT_GYRO_FS_2000DPS
-                                            | REG_VAL_BIT_GYRO_DLPF);
-  I2C_WriteOneByte( REG_ADD_ACCEL_SMPLRT_DIV_1,  0x00);  // 119 Hz
-  I2C_WriteOneByte( REG_ADD_ACCEL_SMPLRT_DIV_2,  0x08);
-  I2C_WriteOneByte(REG_ADD_ACCEL_CONFIG, REG_VAL_BIT_ACCEL_DLPCFG_6
-                                           | REG_VAL_BIT_ACCEL_FS_4g
-                                           | REG_VAL_BIT_ACCEL_DLPF);
-
-
-  /* user bank 0 register */
-  I2C_WriteOneByte(REG_ADD_REG_BANK_SEL, REG_VAL_REG_BANK_0);
+  icm20948Configure(&gstIcm20948LowLatency);
 
   sleep_ms(100);
   /* offset */
@@ -252,6 +424,24 @@ void icm20948init() {
                          REG_ADD_MAG_CNTL2, REG_VAL_MAG_MODE_20HZ);
 }
 
+// Low-power mode keeps only a duty-cycled accelerometer running, enough to
+// notice the board being picked up. The gyro needs ~35 ms to restart.
+void icm20948SetLowPower(bool enable) {
+  I2C_WriteOneByte(REG_ADD_REG_BANK_SEL, REG_VAL_REG_BANK_0);
+  uint8_t lpConfig = I2C_ReadOneByte(REG_ADD_LP_CONFIG);
+  if (enable) {
+    I2C_WriteOneByte(REG_ADD_PWR_MGMT_2, REG_VAL_DISABLE_GYRO);
+    I2C_WriteOneByte(REG_ADD_LP_CONFIG, lpConfig | REG_VAL_BIT_ACCEL_CYCLE);
+    I2C_WriteOneByte(REG_ADD_PWR_MGMT_1, REG_VAL_RUN_MODE | REG_VAL_BIT_LP_EN);
+  }
+  else {
+    I2C_WriteOneByte(REG_ADD_PWR_MGMT_1, REG_VAL_RUN_MODE);
+    I2C_WriteOneByte(REG_ADD_LP_CONFIG, lpConfig & ~REG_VAL_BIT_ACCEL_CYCLE);
+    I2C_WriteOneByte(REG_ADD_PWR_MGMT_2, 0x00);
+    sleep_ms(35);
+  }
+}
+
 bool icm20948Check() {
   bool bRet = false;
   if (REG_VAL_WIA == I2C_ReadOneByte(REG_ADD_WIA)) {
@@ -282,9 +472,9 @@ bool icm20948GyroRead(float *ps16X, float *ps16Y, float *ps16Z) {
   u8Buf[1]  = I2C_ReadOneByte(REG_ADD_GYRO_ZOUT_H);
   s16Buf[2] = (u8Buf[1] << 8) | u8Buf[0];
 
-  *ps16X = s16Buf[0] * 2000.0 / 32768.0;
-  *ps16Y = s16Buf[1] * 2000.0 / 32768.0;
-  *ps16Z = s16Buf[2] * 2000.0 / 32768.0;
+  *ps16X = s16Buf[0] * (250 << gstConfig.u8GyroFs) / 32768.0;
+  *ps16Y = s16Buf[1] * (250 << gstConfig.u8GyroFs) / 32768.0;
+  *ps16Z = s16Buf[2] * (250 << gstConfig.u8GyroFs) / 32768.0;
 
  /*
   for (i = 0; i < 3; i++) {
@@ -323,9 +513,9 @@ bool icm20948AccelRead(float *ps16X, float *ps16Y, float *ps16Z) {
   u8Buf[1]  = I2C_ReadOneByte(REG_ADD_ACCEL_ZOUT_H);
   s16Buf[2] = (u8Buf[1] << 8) | u8Buf[0];
 
-  *ps16X = s16Buf[0] * 4.0 / 32768.0;
-  *ps16Y = s16Buf[1] * 4.0 / 32768.0;
-  *ps16Z = s16Buf[2] * 4.0 / 32768.0;
+  *ps16X = s16Buf[0] * (2 << gstConfig.u8AccelFs) / 32768.0;
+  *ps16Y = s16Buf[1] * (2 << gstConfig.u8AccelFs) / 32768.0;
+  *ps16Z = s16Buf[2] * (2 << gstConfig.u8AccelFs) / 32768.0;
 
   //  for (i = 0; i < 3; i++)
   //	{
@@ -343,6 +533,88 @@ bool icm20948AccelRead(float *ps16X, float *ps16Y, float *ps16Z) {
   return true;
 }
 
+// Accelerometer and gyro in one burst: their output registers are
+// contiguous, so 12 bytes cost one transaction instead of twelve.
+bool icm20948MotionRead(ICM20948_ST_MOTION *pstMotion) {
+  uint8_t u8Buf[12];
+  int16_t s16Raw[6];
+  uint8_t i;
+
+  uint32_t u32TimeUs = time_us_32();
+
+  /* A failed read leaves the last sample in place */
+  if (I2C_ReadBytes(REG_ADD_ACCEL_XOUT_H, u8Buf, sizeof(u8Buf)) != PICO_OK) {
+    return false;
+  }
+  pstMotion->u32TimeUs = u32TimeUs;
+  for (i = 0; i < 6; i++) {
+    s16Raw[i] = (u8Buf[2 * i] << 8) | u8Buf[2 * i + 1];
+  }
+
+  /* 32768 counts is full scale: 2000 mg << fs and 4363 mrad/s << fs */
+  for (i = 0; i < 3; i++) {
+    pstMotion->s32AccelMg[i]   = (s16Raw[i] * (2000 << gstConfig.u8AccelFs)) / 32768;
+    pstMotion->s32GyroMrads[i] = (s16Raw[3 + i] * (4363 << gstConfig.u8GyroFs)) / 32768;
+  }
+
+  return s16Raw[0] || s16Raw[1] || s16Raw[2];
+}
+
+int icm20948Configure(const ICM20948_ST_CONFIG *pstConfig) {
+  uint8_t u8Gyro  = (pstConfig->u8GyroFs & 0x03) << REG_VAL_BIT_FS_SHIFT;
+  uint8_t u8Accel = (pstConfig->u8AccelFs & 0x03) << REG_VAL_BIT_FS_SHIFT;
+  if (pstConfig->u8GyroDlpf < ICM20948_DLPF_OFF) {
+    u8Gyro |= (pstConfig->u8GyroDlpf << REG_VAL_BIT_DLPCFG_SHIFT) | REG_VAL_BIT_GYRO_DLPF;
+  }
+  if (pstConfig->u8AccelDlpf < ICM20948_DLPF_OFF) {
+    u8Accel |= (pstConfig->u8AccelDlpf << REG_VAL_BIT_DLPCFG_SHIFT) | REG_VAL_BIT_ACCEL_DLPF;
+  }
+
+  /* user bank 2 registers, then back to bank 0. A failed write stops the
+   * rest; the bus recovery puts the sensor back in bank 0. */
+  const uint8_t u8Writes[][2] = {
+    { REG_ADD_REG_BANK_SEL, REG_VAL_REG_BANK_2 },
+    { REG_ADD_GYRO_SMPLRT_DIV, pstConfig->u8GyroDiv },
+    { REG_ADD_GYRO_CONFIG_1, u8Gyro },
+    { REG_ADD_ACCEL_SMPLRT_DIV_1, (pstConfig->u16AccelDiv >> 8) & 0x0F },
+    { REG_ADD_ACCEL_SMPLRT_DIV_2, pstConfig->u16AccelDiv & 0xFF },
+    { REG_ADD_ACCEL_CONFIG, u8Accel },
+    { REG_ADD_REG_BANK_SEL, REG_VAL_REG_BANK_0 },
+  };
+  for (uint8_t i = 0; i < sizeof(u8Writes) / sizeof(u8Writes[0]); i++) {
+    int ret = I2C_WriteOneByte(u8Writes[i][0], u8Writes[i][1]);
+    if (ret != PICO_OK) {
+      return ret;
+    }
+  }
+
+  gstConfig = *pstConfig;
+  gstConfig.u8GyroFs &= 0x03;
+  gstConfig.u8AccelFs &= 0x03;
+  gstConfig.u16AccelDiv &= 0x0FFF;
+  return PICO_OK;
+}
+
+const ICM20948_ST_CONFIG *icm20948GetConfig(void) {
+  return &gstConfig;
+}
+
+uint32_t icm20948SampleDelayUs(void) {
+  uint8_t  u8GyroDlpf  = gstConfig.u8GyroDlpf < ICM20948_DLPF_OFF ? gstConfig.u8GyroDlpf : ICM20948_DLPF_OFF;
+  uint8_t  u8AccelDlpf = gstConfig.u8AccelDlpf < ICM20948_DLPF_OFF ? gstConfig.u8AccelDlpf : ICM20948_DLPF_OFF;
+  /* Half a sample period: 1e6 / 1100 Hz / 2 and 1e6 / 1125 Hz / 2 */
+  uint32_t u32Gyro  = gu16GyroDelayUs[u8GyroDlpf] + 455 * (1 + gstConfig.u8GyroDiv);
+  uint32_t u32Accel = gu16AccelDelayUs[u8AccelDlpf] + 444 * (1 + gstConfig.u16AccelDiv);
+  return u32Gyro > u32Accel ? u32Gyro : u32Accel;
+}
+
+uint32_t icm20948SamplePeriodUs(void) {
+  /* 1e6 / 1100 Hz and 1e6 / 1125 Hz */
+  uint32_t u32Gyro  = 909 * (1 + gstConfig.u8GyroDiv);
+  uint32_t u32Accel = 889 * (1 + gstConfig.u16AccelDiv);
+  return u32Gyro < u32Accel ? u32Gyro : u32Accel;
+}
+
 bool icm20948MagRead(float *ps16X, float *ps16Y, float *ps16Z) {
   uint8_t counter = 20;
   uint8_t u8Data[MAG_DATA_LEN];
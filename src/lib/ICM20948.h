@@ -11,6 +11,23 @@
 
 #define ICM20948_DEVICE      0X00
 
+/* I2C bus. Every transfer is bounded by ICM20948_I2C_TIMEOUT_US. After a
+ * failure the bus is reset (icm20948BusRecover), the sensor is put back in
+ * register bank 0 and the bus is left alone for ICM20948_I2C_RETRY_MS,
+ * transfers in between failing at once, so a wedged or missing sensor costs
+ * two timeouts per retry period: a few ms at worst, well inside the main
+ * loop's hang threshold (HANG_MILLIS in main.c). With
+ * ICM20948_FAULT_INJECTION 1, icm20948InjectStalls() makes the next
+ * transfers hang until they time out, as a glitched bus would. */
+#define ICM20948_SDA_PIN 4
+#define ICM20948_SCL_PIN 5
+#define ICM20948_I2C_TIMEOUT_US 2000
+#define ICM20948_I2C_RETRY_MS 50
+
+#ifndef ICM20948_FAULT_INJECTION
+#define ICM20948_FAULT_INJECTION 0
+#endif
+
 /* define ICM-20948 Device I2C address*/
 #define I2C_ADD_ICM20948 0x68
 #define I2C_ADD_ICM20948_AK09916 0x0C
@@ -31,6 +48,9 @@
 #define REG_ADD_PWR_MIGMT_1 0x06
 #define REG_VAL_ALL_RGE_RESET 0x80
 #define REG_VAL_RUN_MODE 0x01  // Non low-power mode
+#define REG_VAL_BIT_LP_EN 0x20  // Duty-cycle the digital circuitry
+#define REG_VAL_BIT_ACCEL_CYCLE 0x20  // LP_CONFIG: duty-cycled accelerometer
+#define REG_VAL_DISABLE_GYRO 0x07  // PWR_MGMT_2: all gyro axes off
 #define REG_ADD_LP_CONFIG 0x05
 #define REG_ADD_PWR_MGMT_1 0x06
 #define REG_ADD_PWR_MGMT_2 0x07
@@ -87,6 +107,8 @@
 #define REG_VAL_BIT_ACCEL_FS_8g 0x04    /* bit[2:1] */
 #define REG_VAL_BIT_ACCEL_FS_16g 0x06   /* bit[2:1] */
 #define REG_VAL_BIT_ACCEL_DLPF 0x01     /* bit[0]   */
+#define REG_VAL_BIT_DLPCFG_SHIFT 3      /* bit[5:3] */
+#define REG_VAL_BIT_FS_SHIFT 1          /* bit[2:1] */
 
 /* user bank 3 register */
 #define REG_ADD_I2C_SLV0_ADDR 0x03
@@ -138,6 +160,53 @@ typedef struct imu_st_sensor_data_tag {
   int16_t s16Z;
 } IMU_ST_SENSOR_DATA;
 
+/* Sensor settings. Output data rates are 1100 Hz / (1 + u8GyroDiv) and
+ * 1125 Hz / (1 + u16AccelDiv); full scales are 250 dps << u8GyroFs and
+ * 2 g << u8AccelFs. The DLPF settings index the datasheet's filter tables
+ * (0 to 7), or ICM20948_DLPF_OFF bypasses the filter. */
+#define ICM20948_DLPF_OFF 8
+
+typedef struct icm20948_st_config_tag {
+  uint8_t  u8GyroDiv;
+  uint8_t  u8GyroFs;
+  uint8_t  u8GyroDlpf;
+  uint16_t u16AccelDiv;
+  uint8_t  u8AccelFs;
+  uint8_t  u8AccelDlpf;
+} ICM20948_ST_CONFIG;
+
+/* Presets. The delay quoted is how old a reading's motion is on average:
+ * the slower sensor's filter group delay plus half a sample period.
+ * Filter delays are estimates for the same filter design on the MPU-9250,
+ * whose datasheet lists them; the ICM-20948's does not.
+ *
+ * Low latency: 275/281 Hz, gyro 51 Hz and accel 50 Hz bandwidth,
+ *   2000 dps, 4 g. About 7 ms. The game's setting.
+ * Low noise: 122/125 Hz, 12 Hz bandwidth, 500 dps, 2 g. About 21 ms.
+ * Low power: 25 Hz, 6 Hz bandwidth, 2000 dps, 4 g. About 51 ms; for the
+ *   duty-cycled accelerometer while paused.
+ *
+ * The original fixed setting (125 Hz, DLPCFG_6 on both) was about 35 ms. */
+extern const ICM20948_ST_CONFIG gstIcm20948LowLatency;
+extern const ICM20948_ST_CONFIG gstIcm20948LowNoise;
+extern const ICM20948_ST_CONFIG gstIcm20948LowPower;
+
+/* A burst read of both sensors, scaled by the configured full scales.
+ * u32TimeUs is when the read started (time_us_32); the motion it shows is
+ * older by icm20948SampleDelayUs(). */
+typedef struct icm20948_st_motion_tag {
+  uint32_t u32TimeUs;
+  int32_t  s32AccelMg[3];
+  int32_t  s32GyroMrads[3];
+} ICM20948_ST_MOTION;
+
+typedef struct icm20948_st_bus_stats_tag {
+  uint32_t u32Timeouts;
+  uint32_t u32Errors;       /* NACKs and other failures */
+  uint32_t u32Recoveries;
+  uint32_t u32Skipped;      /* transfers refused while the bus was down */
+} ICM20948_ST_BUS_STATS;
+
 typedef struct icm20948_st_avg_data_tag {
   uint8_t u8Index;
   int16_t s16AvgBuffer[8];
@@ -152,6 +221,17 @@ void icm20948init();
 bool icm20948GyroRead(float *ps16X, float *ps16Y, float *ps16Z);
 bool icm20948AccelRead(float *ps16X, float *ps16Y, float *ps16Z);
 bool icm20948MagRead(float *ps16X, float *ps16Y, float *ps16Z);
+bool icm20948MotionRead(ICM20948_ST_MOTION *pstMotion);
+/* Write a setting. Returns PICO_OK, or the first transfer's error with the
+ * rest left unwritten; the sensor may then hold part of the new setting,
+ * but reads go on being scaled and timed for the last one written whole,
+ * which icm20948GetConfig returns, until a later call gets through. */
+int  icm20948Configure(const ICM20948_ST_CONFIG *pstConfig);
+const ICM20948_ST_CONFIG *icm20948GetConfig(void);
+uint32_t icm20948SampleDelayUs(void);
+/* Output period of the faster sensor in the current setting: reading more
+ * often than this only sees the same sample again. */
+uint32_t icm20948SamplePeriodUs(void);
 bool icm20948MagCheck(void);
 void icm20948CalAvgValue(uint8_t *pIndex, int16_t *pAvgBuffer, int16_t InVal,
                                 int32_t *pOutVal);
@@ -161,13 +241,22 @@ void icm20948ReadSecondary(uint8_t u8I2CAddr, uint8_t u8RegAddr, uint8_t u8Len,
 void icm20948WriteSecondary(uint8_t u8I2CAddr, uint8_t u8RegAddr,
                                     uint8_t u8data);
 bool icm20948Check();
+void icm20948SetLowPower(bool enable);
 
 bool reserved_addr(uint8_t addr);
 
 void imuInit(IMU_EN_SENSOR_TYPE *penMotionSensorType);
 
-void I2C_WriteOneByte(uint8_t reg, uint8_t value);
+void icm20948BusInit(uint32_t u32Baud);
+void icm20948BusRecover(void);
+const ICM20948_ST_BUS_STATS *icm20948BusStats(void);
+void icm20948InjectStalls(uint16_t u16Count);
+
+/* Return PICO_OK or a PICO_ERROR_ code. I2C_ReadOneByte returns 0 when the
+ * read fails. */
+int  I2C_WriteOneByte(uint8_t reg, uint8_t value);
 char I2C_ReadOneByte(uint8_t reg);
+int  I2C_ReadBytes(uint8_t reg, uint8_t *buf, uint8_t len);
 
 int  dataReady();
 bool imuDataGet(IMU_ST_ANGLES_DATA *pstAngles,
@@ -0,0 +1,15 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "ai.h"
+
+int Ai_InterceptY(int x, int y, int dx, int dy, int targetX, int range) {
+    const int distance = targetX - x;
+    if(dx <= 0 || distance <= 0 || range <= 0)
+        return y;
+
+    // Ticks until x reaches the target, rounding up as the ball overshoots
+    const int ticks = (distance + dx - 1) / dx;
+    int unfolded = (y + dy * ticks) % (2 * range);
+    if(unfolded < 0)
+        unfolded += 2 * range;
+    return unfolded > range ? 2 * range - unfolded : unfolded;
+}
@@ -0,0 +1,26 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __AI_H__
+#define __AI_H__
+
+// Where the ball will be when it reaches the AI paddle, worked out in one
+// step rather than by running the ball forward. The ball moves a fixed step
+// on each axis per tick, so its y with the walls taken away is linear in the
+// number of ticks; the bounces fold that back into [0, range], a triangle
+// wave of period 2 * range. Integer only, no loop. Exact for the one-pixel
+// vertical step the game uses: a larger one lets the ball past the walls
+// by up to a step before it turns.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The top edge of a ball at x, y moving dx, dy pixels per tick, on the tick
+// its x first reaches targetX, with y bouncing between 0 and range. A ball
+// already there, or not moving towards it (dx <= 0), is where it is now.
+int Ai_InterceptY(int x, int y, int dx, int dy, int targetX, int range);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __AI_H__
@@ -0,0 +1,78 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "backlight.h"
+#include "DEV_Config.h"
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+// Fade state, shared with the timer callback. Levels are in percent scaled
+// by 256 so short fades still move every step.
+static struct repeating_timer fadeTimer;
+static volatile bool timerRunning;
+static volatile int32_t level;
+static volatile int32_t target;
+static volatile int32_t step;
+
+static void Backlight_Apply(int32_t scaled) {
+    const uint64_t full = 100 << 8;
+    DEV_SET_PWM_Level((uint64_t)scaled * scaled * DEV_PWM_TOP / (full * full));
+}
+
+static int32_t Backlight_Step(int32_t from, int32_t to, uint32_t ms) {
+    int32_t steps = ms / BACKLIGHT_STEP_MS;
+    if(steps < 1)
+        steps = 1;
+    int32_t delta = (to - from) / steps;
+    if(delta == 0)
+        delta = to > from ? 1 : -1;
+    return delta;
+}
+
+static bool Backlight_Tick(struct repeating_timer *t) {
+    if(level == target) {
+        timerRunning = false;
+        return false;
+    }
+
+    int32_t next = level + step;
+    if((step > 0 && next > target) || (step < 0 && next < target))
+        next = target;
+    level = next;
+    Backlight_Apply(level);
+    return true;
+}
+
+static void Backlight_Start(int32_t to, uint32_t ms) {
+    uint32_t irq = save_and_disable_interrupts();
+    target = to;
+    step = Backlight_Step(level, to, ms);
+    bool start = !timerRunning;
+    timerRunning = true;
+    restore_interrupts(irq);
+
+    if(start)
+        add_repeating_timer_ms(-BACKLIGHT_STEP_MS, Backlight_Tick, NULL, &fadeTimer);
+}
+
+void Backlight_Set(uint8_t percent) {
+    if(percent > 100)
+        percent = 100;
+
+    uint32_t irq = save_and_disable_interrupts();
+    level = target = percent << 8;
+    Backlight_Apply(level);
+    restore_interrupts(irq);
+}
+
+void Backlight_FadeTo(uint8_t percent, uint32_t ms) {
+    if(percent > 100)
+        percent = 100;
+    Backlight_Start(percent << 8, ms);
+}
+
+uint8_t Backlight_Get(void) {
+    return level >> 8;
+}
+
+bool Backlight_IsFading(void) {
+    return level != target;
+}
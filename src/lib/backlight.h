@@ -0,0 +1,32 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __BACKLIGHT_H__
+#define __BACKLIGHT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Backlight brightness on the PWM slice set up by DEV_Module_Init. Levels
+// are in percent of perceived brightness and mapped through a square-law
+// curve onto the PWM duty, so fades look even at the dark end. Fades are
+// stepped from a repeating timer every BACKLIGHT_STEP_MS, which only runs
+// while a fade is in progress, and need nothing from the caller once
+// started. The backlight is off after DEV_Module_Init. Without DEV_BL_PIN
+// (DEV_Config.h) nothing drives BLK, and all of this only keeps the level.
+
+#define BACKLIGHT_STEP_MS 10
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Set the level now, cancelling any fade
+void Backlight_Set(uint8_t percent);
+void Backlight_FadeTo(uint8_t percent, uint32_t ms);
+uint8_t Backlight_Get(void);
+bool Backlight_IsFading(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __BACKLIGHT_H__
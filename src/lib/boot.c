@@ -0,0 +1,54 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "boot.h"
+#include <stdio.h>
+#include "pico/stdlib.h"
+
+typedef struct {
+    const char *name;
+    uint64_t start;
+    uint64_t end;
+} Boot_Phase;
+
+static Boot_Phase phases[2][BOOT_MAX_PHASES];
+static uint8_t phaseCount[2];
+
+uint8_t Boot_PhaseBegin(const char *name) {
+    uint core = get_core_num();
+    uint8_t i = phaseCount[core];
+    if(i >= BOOT_MAX_PHASES)
+        return BOOT_MAX_PHASES;
+
+    phases[core][i] = (Boot_Phase){ name, time_us_64(), 0 };
+    phaseCount[core]++;
+    return i;
+}
+
+void Boot_PhaseEnd(uint8_t phase) {
+    uint core = get_core_num();
+    if(phase < phaseCount[core])
+        phases[core][phase].end = time_us_64();
+}
+
+void Boot_PrintTimeline(void) {
+    uint8_t next[2] = { 0, 0 };
+
+    printf("boot timeline (ms since boot)\n");
+    // Merge the two per-core lists by start time
+    while(next[0] < phaseCount[0] || next[1] < phaseCount[1]) {
+        uint8_t core;
+        if(next[1] >= phaseCount[1])
+            core = 0;
+        else if(next[0] >= phaseCount[0])
+            core = 1;
+        else
+            core = phases[0][next[0]].start <= phases[1][next[1]].start ? 0 : 1;
+
+        const Boot_Phase *p = &phases[core][next[core]++];
+        if(p->end) {
+            printf("  core%u %-14s %7.1f .. %7.1f  (%.1f)\n", core, p->name,
+                   p->start / 1000.0, p->end / 1000.0, (p->end - p->start) / 1000.0);
+        } else {
+            printf("  core%u %-14s %7.1f .. unfinished\n", core, p->name, p->start / 1000.0);
+        }
+    }
+}
@@ -0,0 +1,26 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __BOOT_H__
+#define __BOOT_H__
+
+#include <stdint.h>
+
+// Boot timeline. Each core records its own init phases (no locking needed),
+// and Boot_PrintTimeline() lists them from both cores in start order, in
+// milliseconds since boot, so overlapping work is easy to see.
+
+#define BOOT_MAX_PHASES 8
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Start a phase on the calling core. Returns a handle for Boot_PhaseEnd.
+uint8_t Boot_PhaseBegin(const char *name);
+void Boot_PhaseEnd(uint8_t phase);
+void Boot_PrintTimeline(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __BOOT_H__
@@ -0,0 +1,95 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "dlog.h"
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "hardware/structs/systick.h"
+
+_Static_assert((DLOG_BUFFER_LEN & (DLOG_BUFFER_LEN - 1)) == 0, "DLOG_BUFFER_LEN must be a power of two");
+
+// Free-running counters; the ring holds head - tail records
+static DLog_Record ring[DLOG_BUFFER_LEN];
+static volatile uint32_t head;
+static volatile uint32_t tail;
+static volatile uint32_t dropped;
+
+void DLog_Write(const char *fmt, uint32_t a, uint32_t b, uint32_t c) {
+    uint32_t irq = save_and_disable_interrupts();
+    if(head - tail >= DLOG_BUFFER_LEN) {
+        dropped++;
+    } else {
+        DLog_Record *r = &ring[head & (DLOG_BUFFER_LEN - 1)];
+        r->fmt = fmt;
+        r->timestamp = time_us_32();
+        r->args[0] = a;
+        r->args[1] = b;
+        r->args[2] = c;
+        head++;
+    }
+    restore_interrupts(irq);
+}
+
+uint32_t DLog_Drain(uint32_t max) {
+    uint32_t n = 0;
+
+    // Only the drain moves tail, so the record can be read without a lock
+    while(n < max && tail != head) {
+        const DLog_Record *r = &ring[tail & (DLOG_BUFFER_LEN - 1)];
+#if DLOG_BINARY
+        // "dlog <fmt address> <timestamp> <arg> <arg> <arg>", all hex
+        printf("dlog %08lx %08lx %08lx %08lx %08lx\n",
+               (unsigned long)(uintptr_t)r->fmt, (unsigned long)r->timestamp,
+               (unsigned long)r->args[0], (unsigned long)r->args[1], (unsigned long)r->args[2]);
+#else
+        printf("[%10lu] ", (unsigned long)r->timestamp);
+        printf(r->fmt, r->args[0], r->args[1], r->args[2]);
+#endif
+        tail++;
+        n++;
+    }
+
+    if(dropped) {
+        uint32_t irq = save_and_disable_interrupts();
+        uint32_t lost = dropped;
+        dropped = 0;
+        restore_interrupts(irq);
+        printf("dlog dropped %lu\n", (unsigned long)lost);
+    }
+    return n;
+}
+
+uint32_t DLog_Dropped(void) {
+    return dropped;
+}
+
+void DLog_MeasureCost(uint32_t count) {
+    // SysTick counts core clock cycles down from 24 bits; keep the run short
+    // enough not to wrap and measure the empty loop to subtract it.
+    if(count == 0)
+        return;
+    if(count > DLOG_BUFFER_LEN)
+        count = DLOG_BUFFER_LEN;
+    DLog_Drain(DLOG_BUFFER_LEN);
+
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+
+    uint32_t start = systick_hw->cvr;
+    for(volatile uint32_t i = 0; i < count; i++) {
+    }
+    uint32_t loop = start - systick_hw->cvr;
+
+    start = systick_hw->cvr;
+    for(volatile uint32_t i = 0; i < count; i++)
+        DLOG1("dlog cost probe %u\n", i);
+    uint32_t total = start - systick_hw->cvr;
+
+    systick_hw->csr = 0;
+    // Throw the probe records away rather than printing them
+    tail = head;
+
+    printf("dlog: %lu cycles per call over %lu calls\n",
+           (unsigned long)((total - loop) / count), (unsigned long)count);
+}
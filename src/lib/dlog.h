@@ -0,0 +1,58 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __DLOG_H__
+#define __DLOG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Deferred logging. A log call stores the address of its format string, a
+// timestamp and up to three raw 32-bit arguments in a RAM ring; nothing is
+// formatted and no I/O happens until DLog_Drain() runs from a low-priority
+// task. Slots are reserved with interrupts held off for a few instructions
+// (the M0+ has no exclusive load/store to build a lock-free reservation on),
+// so the macros are safe from IRQ handlers. When the ring is full new
+// records are dropped and counted.
+//
+// Arguments are integers only (%d %u %x %c); pass floats scaled, e.g. in
+// thousandths. The format string must be a literal.
+//
+// With DLOG_BINARY the drain sends each record as hex instead of text and
+// tools/dlog_decode.py formats it on the host, looking the format strings up
+// in the ELF.
+
+#ifndef DLOG_BINARY
+#define DLOG_BINARY 0
+#endif
+
+// Records in the ring, a power of two
+#ifndef DLOG_BUFFER_LEN
+#define DLOG_BUFFER_LEN 64
+#endif
+
+typedef struct {
+    const char *fmt;
+    uint32_t timestamp;
+    uint32_t args[3];
+} DLog_Record;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void DLog_Write(const char *fmt, uint32_t a, uint32_t b, uint32_t c);
+// Format or ship up to max records. Returns the number drained.
+uint32_t DLog_Drain(uint32_t max);
+uint32_t DLog_Dropped(void);
+// Time count log calls with SysTick and print the average cost in cycles
+void DLog_MeasureCost(uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define DLOG0(fmt)          DLog_Write((fmt), 0, 0, 0)
+#define DLOG1(fmt, a)       DLog_Write((fmt), (uint32_t)(a), 0, 0)
+#define DLOG2(fmt, a, b)    DLog_Write((fmt), (uint32_t)(a), (uint32_t)(b), 0)
+#define DLOG3(fmt, a, b, c) DLog_Write((fmt), (uint32_t)(a), (uint32_t)(b), (uint32_t)(c))
+
+#endif // __DLOG_H__
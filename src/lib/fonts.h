@@ -12,6 +12,5 @@ typedef struct {
 
 
 extern FontDef Font_16x26;
-extern const uint8_t arducam_logo[25608];
 
 #endif // __FONTS_H__
@@ -0,0 +1,185 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "framebuffer.h"
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#if FB_USE_INTERP
+#include "hardware/interp.h"
+#include "hardware/structs/systick.h"
+#endif
+
+static uint8_t fb[FB_SIZE];
+
+// Palette entries are kept byte-swapped so an expanded row can be handed
+// straight to the SPI without another pass.
+static uint16_t palette[FB_PALETTE_LEN];
+
+static uint16_t line[FB_WIDTH];
+
+static inline uint16_t FB_Swap(uint16_t color) {
+    return (color >> 8) | (color << 8);
+}
+
+void FB_Init(void) {
+    static const uint16_t defaults[] = {
+        ST7735_BLACK, ST7735_BLUE, ST7735_RED, ST7735_GREEN,
+        ST7735_CYAN, ST7735_MAGENTA, ST7735_YELLOW, ST7735_WHITE
+    };
+
+    for(uint8_t i = 0; i < FB_PALETTE_LEN; i++) {
+        palette[i] = i < count_of(defaults) ? FB_Swap(defaults[i]) : 0;
+    }
+    FB_Fill(FB_BLACK);
+}
+
+void FB_SetPalette(uint8_t index, uint16_t color) {
+    palette[index & 0x0F] = FB_Swap(color);
+}
+
+uint16_t FB_GetPalette(uint8_t index) {
+    return FB_Swap(palette[index & 0x0F]);
+}
+
+void FB_Fill(uint8_t index) {
+    index &= 0x0F;
+    memset(fb, index | (index << 4), sizeof(fb));
+}
+
+void FB_DrawPixel(uint16_t x, uint16_t y, uint8_t index) {
+    if((x >= FB_WIDTH) || (y >= FB_HEIGHT))
+        return;
+
+    uint8_t *p = &fb[y * FB_STRIDE + (x >> 1)];
+    if(x & 1) {
+        *p = (*p & 0x0F) | ((index & 0x0F) << 4);
+    } else {
+        *p = (*p & 0xF0) | (index & 0x0F);
+    }
+}
+
+void FB_FillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t index) {
+    // clipping
+    if((x >= FB_WIDTH) || (y >= FB_HEIGHT)) return;
+    if((x + w - 1) >= FB_WIDTH) w = FB_WIDTH - x;
+    if((y + h - 1) >= FB_HEIGHT) h = FB_HEIGHT - y;
+
+    index &= 0x0F;
+    const uint8_t both = index | (index << 4);
+
+    for(uint16_t row = y; row < y + h; row++) {
+        uint16_t x0 = x;
+        uint16_t x1 = x + w;
+        uint8_t *p = &fb[row * FB_STRIDE];
+
+        // Odd leading and trailing pixels share a byte with a neighbour,
+        // everything between them can be written a whole byte at a time.
+        if(x0 & 1) {
+            p[x0 >> 1] = (p[x0 >> 1] & 0x0F) | (index << 4);
+            x0++;
+        }
+        if((x1 & 1) && x1 > x0) {
+            x1--;
+            p[x1 >> 1] = (p[x1 >> 1] & 0xF0) | index;
+        }
+        if(x1 > x0) {
+            memset(&p[x0 >> 1], both, (x1 - x0) >> 1);
+        }
+    }
+}
+
+// The portable expansion, and the reference the interpolator must match.
+static void FB_ExpandRowC(const uint8_t *src, uint16_t *dst, uint16_t pixels) {
+    for(uint16_t i = 0; i < pixels / 2; i++) {
+        dst[2 * i] = palette[src[i] & 0x0F];
+        dst[2 * i + 1] = palette[src[i] >> 4];
+    }
+    if(pixels & 1) {
+        dst[pixels - 1] = palette[src[pixels / 2] & 0x0F];
+    }
+}
+
+#if FB_USE_INTERP
+// The palette lookup for both nibbles of a byte is done by interp0: accum0
+// holds the byte shifted left by one, lane 0 masks out the low nibble and
+// lane 1 (crossed onto accum0) the high nibble, both already scaled to a
+// uint16_t offset and added to the palette base. Each byte then costs two
+// peeks and two loads.
+static void FB_ExpandRowInterp(const uint8_t *src, uint16_t *dst, uint16_t pixels) {
+    interp_config cfg = interp_default_config();
+    interp_config_set_shift(&cfg, 0);
+    interp_config_set_mask(&cfg, 1, 4);
+    interp_set_config(interp0, 0, &cfg);
+    interp_config_set_shift(&cfg, 4);
+    interp_config_set_cross_input(&cfg, true);
+    interp_set_config(interp0, 1, &cfg);
+    interp0->base[0] = (uint32_t)palette;
+    interp0->base[1] = (uint32_t)palette;
+
+    for(uint16_t i = 0; i < pixels / 2; i++) {
+        interp0->accum[0] = (uint32_t)src[i] << 1;
+        dst[2 * i] = *(uint16_t *)interp0->peek[0];
+        dst[2 * i + 1] = *(uint16_t *)interp0->peek[1];
+    }
+    if(pixels & 1) {
+        dst[pixels - 1] = palette[src[pixels / 2] & 0x0F];
+    }
+}
+#endif
+
+// Expand packed 4bpp pixels into byte-swapped RGB565.
+void FB_ExpandRow(const uint8_t *src, uint16_t *dst, uint16_t pixels) {
+#if FB_USE_INTERP
+    FB_ExpandRowInterp(src, dst, pixels);
+#else
+    FB_ExpandRowC(src, dst, pixels);
+#endif
+}
+
+void FB_FlushRows(uint16_t y, uint16_t h) {
+    if(y >= FB_HEIGHT) return;
+    if((y + h - 1) >= FB_HEIGHT) h = FB_HEIGHT - y;
+
+    ST7735_BeginPixels(0, y, FB_WIDTH, h);
+    for(uint16_t row = y; row < y + h; row++) {
+        FB_ExpandRow(&fb[row * FB_STRIDE], line, FB_WIDTH);
+        ST7735_WritePixels((const uint8_t *)line, sizeof(line));
+    }
+    ST7735_EndPixels();
+}
+
+void FB_Flush(void) {
+    FB_FlushRows(0, FB_HEIGHT);
+}
+
+#if FB_USE_INTERP
+void FB_MeasureCost(void) {
+    // SysTick counts core clock cycles down from 24 bits; a frame of either
+    // expansion is a few hundred thousand, well short of wrapping.
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+
+    uint32_t start = systick_hw->cvr;
+    for(uint16_t row = 0; row < FB_HEIGHT; row++)
+        FB_ExpandRowInterp(&fb[row * FB_STRIDE], line, FB_WIDTH);
+    uint32_t interp = start - systick_hw->cvr;
+
+    start = systick_hw->cvr;
+    for(uint16_t row = 0; row < FB_HEIGHT; row++)
+        FB_ExpandRowC(&fb[row * FB_STRIDE], line, FB_WIDTH);
+    uint32_t loop = start - systick_hw->cvr;
+
+    systick_hw->csr = 0;
+
+    const uint32_t pixels = (uint32_t)FB_WIDTH * FB_HEIGHT;
+    printf("fb: %u bytes buffered, %lu as RGB565, %lu sent per flush\n",
+           (unsigned)FB_SIZE, (unsigned long)(pixels * 2),
+           (unsigned long)(ST7735_COLOR_12BIT ? pixels * 3 / 2 : pixels * 2));
+    printf("fb: expanding a frame takes %lu cycles with interp0 (%lu.%lu per pixel), "
+           "%lu with the C loop (%lu.%lu per pixel)\n",
+           (unsigned long)interp, (unsigned long)(interp / pixels),
+           (unsigned long)(interp * 10 / pixels % 10),
+           (unsigned long)loop, (unsigned long)(loop / pixels),
+           (unsigned long)(loop * 10 / pixels % 10));
+}
+#endif
@@ -0,0 +1,64 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __FRAMEBUFFER_H__
+#define __FRAMEBUFFER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "st7735.h"
+
+// 4bpp palette-indexed framebuffer covering the whole panel. Two pixels are
+// packed per byte, even x in the low nibble. Pixels are expanded to RGB565
+// through a 16-entry palette at flush time, so changing a palette entry
+// recolours every pixel using it without touching the buffer. The buffer
+// covers the panel in its default rotation.
+//
+// The game itself draws straight to the panel and flashes on game over by
+// display inversion (st7735_fx.h), which costs no pixel writes either; the
+// framebuffer is for screens drawn and recoloured as a whole.
+
+#define FB_WIDTH       ST7735_WIDTH
+#define FB_HEIGHT      ST7735_HEIGHT
+#define FB_STRIDE      (FB_WIDTH / 2)
+#define FB_SIZE        (FB_STRIDE * FB_HEIGHT)
+#define FB_PALETTE_LEN 16
+
+// Set to 0 to expand rows with the portable C loop instead of interp0.
+#ifndef FB_USE_INTERP
+#define FB_USE_INTERP 1
+#endif
+
+// Default palette indices, loaded by FB_Init
+#define FB_BLACK   0
+#define FB_BLUE    1
+#define FB_RED     2
+#define FB_GREEN   3
+#define FB_CYAN    4
+#define FB_MAGENTA 5
+#define FB_YELLOW  6
+#define FB_WHITE   7
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void FB_Init(void);
+void FB_SetPalette(uint8_t index, uint16_t color);
+uint16_t FB_GetPalette(uint8_t index);
+void FB_Fill(uint8_t index);
+void FB_DrawPixel(uint16_t x, uint16_t y, uint8_t index);
+void FB_FillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      uint8_t index);
+void FB_ExpandRow(const uint8_t *src, uint16_t *dst, uint16_t pixels);
+void FB_Flush(void);
+void FB_FlushRows(uint16_t y, uint16_t h);
+#if FB_USE_INTERP
+// Print the buffer and bus bytes of a frame and the cycles taken to expand
+// one with interp0 and with the C loop.
+void FB_MeasureCost(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __FRAMEBUFFER_H__
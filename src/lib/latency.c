@@ -0,0 +1,98 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "latency.h"
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+
+static const char *const stageNames[LATENCY_STAGE_COUNT] = {
+    [LATENCY_I2C] = "i2c",
+    [LATENCY_UPDATE] = "update",
+    [LATENCY_HANDOFF] = "handoff",
+    [LATENCY_SPI] = "spi",
+    [LATENCY_TOTAL] = "total",
+};
+
+static bool enabled;
+
+// Timestamps of the input waiting to be painted
+static bool pending;
+static bool painting;
+static uint32_t readStart;
+static uint32_t acquired;
+static uint32_t updated;
+static uint32_t paintStart;
+
+static uint32_t samples[LATENCY_STAGE_COUNT][LATENCY_SAMPLES];
+static uint32_t sampleCount;
+
+void Latency_Enable(bool enable) {
+    enabled = enable;
+    pending = false;
+    painting = false;
+    if(enable)
+        sampleCount = 0;
+}
+
+bool Latency_Enabled(void) {
+    return enabled;
+}
+
+void Latency_Input(uint32_t start, uint32_t done) {
+    if(!enabled || pending)
+        return;
+
+    readStart = start;
+    acquired = done;
+    updated = time_us_32();
+    pending = true;
+}
+
+void Latency_PaintStart(void) {
+    if(!pending)
+        return;
+
+    paintStart = time_us_32();
+    painting = true;
+}
+
+void Latency_PaintEnd(void) {
+    if(!painting)
+        return;
+
+    uint32_t end = time_us_32();
+    uint32_t slot = sampleCount++ % LATENCY_SAMPLES;
+    samples[LATENCY_I2C][slot] = acquired - readStart;
+    samples[LATENCY_UPDATE][slot] = updated - acquired;
+    samples[LATENCY_HANDOFF][slot] = paintStart - updated;
+    samples[LATENCY_SPI][slot] = end - paintStart;
+    samples[LATENCY_TOTAL][slot] = end - readStart;
+    pending = false;
+    painting = false;
+}
+
+static void Latency_Sort(uint32_t *values, uint32_t n) {
+    for(uint32_t i = 1; i < n; i++) {
+        uint32_t v = values[i];
+        uint32_t j = i;
+        for(; j > 0 && values[j - 1] > v; j--)
+            values[j] = values[j - 1];
+        values[j] = v;
+    }
+}
+
+void Latency_Report(void) {
+    static uint32_t sorted[LATENCY_SAMPLES];
+    uint32_t n = sampleCount < LATENCY_SAMPLES ? sampleCount : LATENCY_SAMPLES;
+
+    printf("latency over %lu inputs (us)\n", (unsigned long)n);
+    if(n == 0)
+        return;
+
+    for(uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+        memcpy(sorted, samples[stage], n * sizeof(sorted[0]));
+        Latency_Sort(sorted, n);
+        printf("%-8s min %6lu median %6lu p99 %6lu max %6lu\n", stageNames[stage],
+               (unsigned long)sorted[0], (unsigned long)sorted[n / 2],
+               (unsigned long)sorted[(n * 99) / 100], (unsigned long)sorted[n - 1]);
+    }
+}
@@ -0,0 +1,48 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __LATENCY_H__
+#define __LATENCY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Input-to-photon latency measurement. While enabled, the first input that
+// moves the paddle is timestamped through each stage of the pipeline until
+// the paint that shows it has left the SPI bus:
+//
+//   read start -> sample acquired -> state updated -> paint start -> paint end
+//
+// Inputs that arrive while one is still waiting for its paint are shown by
+// the same paint and are not measured again. Latency_Report() prints min,
+// median, p99 and max of every stage and of the total over the last
+// LATENCY_SAMPLES inputs. tools/latency_sim.py models the same pipeline on
+// the host.
+
+#define LATENCY_SAMPLES 128
+
+typedef enum {
+    LATENCY_I2C,        // read start to sample acquired
+    LATENCY_UPDATE,     // sample acquired to state updated
+    LATENCY_HANDOFF,    // state updated to paint start
+    LATENCY_SPI,        // paint start to paint end
+    LATENCY_TOTAL,      // read start to paint end
+    LATENCY_STAGE_COUNT
+} Latency_Stage;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void Latency_Enable(bool enable);
+bool Latency_Enabled(void);
+// An input read between readStart and acquired has just updated the state
+void Latency_Input(uint32_t readStart, uint32_t acquired);
+void Latency_PaintStart(void);
+// Call once the paint is on the panel (the SPI transfer has finished)
+void Latency_PaintEnd(void);
+void Latency_Report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __LATENCY_H__
@@ -1,6 +1,15 @@
 /* vim: set ai et ts=4 sw=4: */
 #include "DEV_Config.h"
 #include "st7735.h"
+#include "st7735_cmdlist.h"
+#include "trace.h"
+#include <string.h>
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/regs/addressmap.h"
+#if ST7735_USE_PIO
+#include "st7735_pio.h"
+#endif
 
 #define DELAY 0x80
 
@@ -41,7 +50,11 @@ static const uint8_t
     ST7735_MADCTL , 1      ,  // 14: Memory access control (directions), 1 arg:
       ST7735_ROTATION,        //     row addr/col addr, bottom to top refresh
     ST7735_COLMOD , 1      ,  // 15: set color mode, 1 arg, no delay:
+#if ST7735_COLOR_12BIT
+      0x03 },                 //     12-bit color
+#else
       0x05 },                 //     16-bit color
+#endif
 
 #if (defined(ST7735_IS_128X128) || defined(ST7735_IS_160X128))
   init_cmds2[] = {            // Init for 7735R, part 2 (1.44" display)
@@ -85,11 +98,18 @@ static const uint8_t
 
 static void ST7735_Select() {
    // HAL_GPIO_WritePin(ST7735_CS_GPIO_Port, ST7735_CS_Pin, GPIO_PIN_RESET);
+   ST7735_WaitIdle();
    DEV_Digital_Write(EPD_CS_PIN, 0);
 }
 
+static void ST7735_PackFlush();
+
 void ST7735_Unselect() {
     //HAL_GPIO_WritePin(ST7735_CS_GPIO_Port, ST7735_CS_Pin, GPIO_PIN_SET);
+    ST7735_PackFlush();
+#if ST7735_USE_PIO
+     ST7735_PioWaitIdle();
+#endif
      DEV_Digital_Write(EPD_CS_PIN, 1);
 }
 
@@ -99,20 +119,149 @@ static void ST7735_Reset() {
     DEV_Digital_Write(EPD_RST_PIN, 1);
 }
 
+// Level the next transfer is sent with. On the SPI backend this is the DC pin
+// itself; the PIO backend sends it in the header of each transfer instead.
+static bool busDc;
+
+static void ST7735_BusDc(bool dc) {
+    busDc = dc;
+#if !ST7735_USE_PIO
+    DEV_Digital_Write(EPD_DC_PIN, dc);
+#endif
+}
+
+static void ST7735_BusWrite(const uint8_t* buff, size_t buff_size) {
+#if ST7735_USE_PIO
+    ST7735_PioStart(busDc, buff_size);
+    ST7735_PioPut(buff, buff_size);
+#else
+    spi_write_blocking(SPI_PORT, buff, buff_size);
+#endif
+}
+
 static void ST7735_WriteCommand(uint8_t cmd) {
     //HAL_GPIO_WritePin(ST7735_DC_GPIO_Port, ST7735_DC_Pin, GPIO_PIN_RESET);
-    DEV_Digital_Write(EPD_DC_PIN, 0);
-    spi_write_blocking(SPI_PORT, &cmd, sizeof(cmd));
+    ST7735_PackFlush();
+    ST7735_BusDc(0);
+    ST7735_BusWrite(&cmd, sizeof(cmd));
    // HAL_SPI_Transmit(&ST7735_SPI_PORT, &cmd, sizeof(cmd), HAL_MAX_DELAY);
 }
 
 static void ST7735_WriteData(uint8_t* buff, size_t buff_size) {
     //HAL_GPIO_WritePin(ST7735_DC_GPIO_Port, ST7735_DC_Pin, GPIO_PIN_SET);
-     DEV_Digital_Write(EPD_DC_PIN, 1);
-     spi_write_blocking(SPI_PORT, buff, buff_size);
+     ST7735_BusDc(1);
+     ST7735_BusWrite(buff, buff_size);
    // HAL_SPI_Transmit(&ST7735_SPI_PORT, buff, buff_size, HAL_MAX_DELAY);
 }
 
+#if ST7735_COLOR_12BIT
+// In 12-bit mode two pixels share three bytes, so a pixel left over at the
+// end of one write is held back and paired with the first pixel of the next.
+// Whatever is still pending when the write ends goes out padded to 2 bytes.
+static bool packPending;
+static uint16_t packPendingColor;
+
+// Convert two RGB565 pixels to packed RGB444 (a in bits 23..12, b in 11..0).
+// Both pixels are narrowed at once in a single 32-bit word; the masks stop
+// bits of one pixel spilling into the other.
+static inline uint32_t ST7735_Pack444(uint16_t a, uint16_t b) {
+    uint32_t w = ((uint32_t)a << 16) | b;
+    w = ((w >> 4) & 0x0F000F00) | ((w >> 3) & 0x00F000F0) | ((w >> 1) & 0x000F000F);
+    return ((w >> 4) & 0x00FFF000) | (w & 0x00000FFF);
+}
+
+static inline uint8_t* ST7735_PutPair(uint8_t *out, uint16_t a, uint16_t b) {
+    uint32_t v = ST7735_Pack444(a, b);
+    out[0] = v >> 16;
+    out[1] = v >> 8;
+    out[2] = v;
+    return out + 3;
+}
+#endif
+
+static void ST7735_PackFlush() {
+#if ST7735_COLOR_12BIT
+    if(!packPending)
+        return;
+    packPending = false;
+    uint32_t v = ST7735_Pack444(packPendingColor, 0);
+    uint8_t data[] = { v >> 16, v >> 8 };
+    ST7735_BusWrite(data, sizeof(data));
+#endif
+}
+
+// Send big-endian RGB565 pixels in the panel's colour format.
+static void ST7735_WritePixelData(const uint8_t* buff, size_t buff_size) {
+    ST7735_BusDc(1);
+#if ST7735_COLOR_12BIT
+    uint8_t out[48];
+    uint8_t *p = out;
+    size_t count = buff_size / 2;
+
+    if(packPending && count) {
+        p = ST7735_PutPair(p, packPendingColor, (buff[0] << 8) | buff[1]);
+        packPending = false;
+        buff += 2;
+        count--;
+    }
+    for(; count >= 2; count -= 2, buff += 4) {
+        p = ST7735_PutPair(p, (buff[0] << 8) | buff[1], (buff[2] << 8) | buff[3]);
+        if(p == out + sizeof(out)) {
+            ST7735_BusWrite(out, sizeof(out));
+            p = out;
+        }
+    }
+    if(count) {
+        packPending = true;
+        packPendingColor = (buff[0] << 8) | buff[1];
+    }
+    if(p != out)
+        ST7735_BusWrite(out, p - out);
+#else
+    ST7735_BusWrite(buff, buff_size);
+#endif
+}
+
+// Send count pixels of one colour.
+static void ST7735_WriteFill(uint16_t color, uint32_t count) {
+    ST7735_BusDc(1);
+#if ST7735_COLOR_12BIT
+    uint8_t out[48];
+    uint8_t *p = out;
+
+    if(packPending && count) {
+        uint8_t pair[3];
+        ST7735_PutPair(pair, packPendingColor, color);
+        ST7735_BusWrite(pair, sizeof(pair));
+        packPending = false;
+        count--;
+    }
+    while(p < out + sizeof(out))
+        p = ST7735_PutPair(p, color, color);
+    for(; count >= 32; count -= 32)
+        ST7735_BusWrite(out, sizeof(out));
+    if(count >= 2)
+        ST7735_BusWrite(out, (count / 2) * 3);
+    if(count & 1) {
+        packPending = true;
+        packPendingColor = color;
+    }
+#else
+    uint8_t data[] = { color >> 8, color & 0xFF };
+#if ST7735_USE_PIO
+    ST7735_PioStart(1, sizeof(data)*count);
+#endif
+    while(count--) {
+       // HAL_SPI_Transmit(&ST7735_SPI_PORT, data, sizeof(data), HAL_MAX_DELAY);
+#if ST7735_USE_PIO
+        ST7735_PioPut(data, sizeof(data));
+#else
+        spi_write_blocking(SPI_PORT, data, sizeof(data));
+#endif
+    }
+#endif
+}
+
 static void ST7735_ExecuteCommandList(const uint8_t *addr) {
     uint8_t numCommands, numArgs;
     uint16_t ms;
@@ -139,16 +288,20 @@ static void ST7735_ExecuteCommandList(const uint8_t *addr) {
     }
 }
 
+// Size and RAM offsets of the panel in the current rotation
+static ST7735_Geometry geometry = { ST7735_WIDTH, ST7735_HEIGHT, ST7735_XSTART, ST7735_YSTART };
+static uint8_t currentRotation = 0;
+
 static void ST7735_SetAddressWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
     // column address set
     ST7735_WriteCommand(ST7735_CASET);
-    uint8_t data[] = { 0x00, x0 + ST7735_XSTART, 0x00, x1 + ST7735_XSTART };
+    uint8_t data[] = { 0x00, x0 + geometry.xstart, 0x00, x1 + geometry.xstart };
     ST7735_WriteData(data, sizeof(data));
 
     // row address set
     ST7735_WriteCommand(ST7735_RASET);
-    data[1] = y0 + ST7735_YSTART;
-    data[3] = y1 + ST7735_YSTART;
+    data[1] = y0 + geometry.ystart;
+    data[3] = y1 + geometry.ystart;
     ST7735_WriteData(data, sizeof(data));
 
     // write to RAM
@@ -157,46 +310,155 @@ static void ST7735_SetAddressWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t
 
 void ST7735_Init() {
     DEV_Module_Init();
+#if ST7735_USE_PIO
+    ST7735_PioInit(EPD_CLK_PIN, EPD_MOSI_PIN, EPD_DC_PIN, ST7735_PIO_BAUD);
+#endif
     ST7735_Select();
     ST7735_Reset();
     ST7735_ExecuteCommandList(init_cmds1);
     ST7735_ExecuteCommandList(init_cmds2);
     ST7735_ExecuteCommandList(init_cmds3);
     ST7735_Unselect();
+    geometry = (ST7735_Geometry){ ST7735_WIDTH, ST7735_HEIGHT, ST7735_XSTART, ST7735_YSTART };
+    currentRotation = 0;
+}
+
+void ST7735_WriteCommandList(const uint8_t *list) {
+    ST7735_Select();
+    ST7735_ExecuteCommandList(list);
+    ST7735_Unselect();
 }
 
 void ST7735_DrawPixel(uint16_t x, uint16_t y, uint16_t color) {
-    if((x >= ST7735_WIDTH) || (y >= ST7735_HEIGHT))
+    if((x >= geometry.width) || (y >= geometry.height))
         return;
 
     ST7735_Select();
 
     ST7735_SetAddressWindow(x, y, x+1, y+1);
     uint8_t data[] = { color >> 8, color & 0xFF };
-    ST7735_WriteData(data, sizeof(data));
+    ST7735_WritePixelData(data, sizeof(data));
 
     ST7735_Unselect();
 }
 
+// Glyphs already expanded to RGB565 (byte-swapped, ready for the SPI),
+// keyed on character, font and colours. Replaced least-recently-used first.
+typedef struct {
+    const uint16_t *font;
+    char ch;
+    uint16_t color;
+    uint16_t bgcolor;
+    uint32_t lastUsed;
+    uint16_t pixels[ST7735_GLYPH_MAX_PIXELS];
+} GlyphCacheEntry;
+
+static GlyphCacheEntry glyphCache[ST7735_GLYPH_CACHE_SIZE];
+static uint32_t glyphClock;
+static uint32_t glyphHits;
+static uint32_t glyphMisses;
+// Characters drawn by ST7735_WriteString and the time taken
+static uint32_t textChars;
+static uint32_t textUs;
+
+static uint16_t rowBuffer[ST7735_MAX_DIM];
+
+static const uint16_t* ST7735_GetGlyph(char ch, FontDef font, uint16_t color, uint16_t bgcolor) {
+    uint32_t i, b, j;
+    GlyphCacheEntry *entry = &glyphCache[0];
+
+    if(font.width * font.height > ST7735_GLYPH_MAX_PIXELS)
+        return NULL;
+
+    glyphClock++;
+    for(i = 0; i < ST7735_GLYPH_CACHE_SIZE; i++) {
+        GlyphCacheEntry *e = &glyphCache[i];
+        if(e->font == font.data && e->ch == ch && e->color == color && e->bgcolor == bgcolor) {
+            e->lastUsed = glyphClock;
+            glyphHits++;
+            return e->pixels;
+        }
+        // Unused entries have lastUsed == 0 so they are picked first
+        if(e->lastUsed < entry->lastUsed)
+            entry = e;
+    }
+
+    glyphMisses++;
+    entry->font = font.data;
+    entry->ch = ch;
+    entry->color = color;
+    entry->bgcolor = bgcolor;
+    entry->lastUsed = glyphClock;
+
+    const uint16_t fg = (color >> 8) | (color << 8);
+    const uint16_t bg = (bgcolor >> 8) | (bgcolor << 8);
+    uint16_t *p = entry->pixels;
+    for(i = 0; i < font.height; i++) {
+        b = font.data[(ch - 32) * font.height + i];
+        for(j = 0; j < font.width; j++) {
+            *p++ = ((b << j) & 0x8000) ? fg : bg;
+        }
+    }
+    return entry->pixels;
+}
+
+void ST7735_GetTextStats(ST7735_TextStats *stats) {
+    stats->hits = glyphHits;
+    stats->misses = glyphMisses;
+    stats->chars = textChars;
+    stats->us = textUs;
+}
+
+void ST7735_ResetTextStats(void) {
+    glyphHits = glyphMisses = 0;
+    textChars = textUs = 0;
+}
+
 static void ST7735_WriteChar(uint16_t x, uint16_t y, char ch, FontDef font, uint16_t color, uint16_t bgcolor) {
     uint32_t i, b, j;
 
     ST7735_SetAddressWindow(x, y, x+font.width-1, y+font.height-1);
 
+    const uint16_t *glyph = ST7735_GetGlyph(ch, font, color, bgcolor);
+    if(glyph) {
+        ST7735_WritePixelData((const uint8_t*)glyph, sizeof(uint16_t)*font.width*font.height);
+        return;
+    }
+
     for(i = 0; i < font.height; i++) {
         b = font.data[(ch - 32) * font.height + i];
         for(j = 0; j < font.width; j++) {
             if((b << j) & 0x8000)  {
                 uint8_t data[] = { color >> 8, color & 0xFF };
-                ST7735_WriteData(data, sizeof(data));
+                ST7735_WritePixelData(data, sizeof(data));
             } else {
                 uint8_t data[] = { bgcolor >> 8, bgcolor & 0xFF };
-                ST7735_WriteData(data, sizeof(data));
+                ST7735_WritePixelData(data, sizeof(data));
             }
         }
     }
 }
 
+// Write len characters that all fit on one line as a single window, one
+// pixel row of the whole line at a time. len must not exceed the cache size
+// so that no glyph fetched for this line is evicted before it is copied.
+static void ST7735_WriteLine(uint16_t x, uint16_t y, const char* str, size_t len, FontDef font, uint16_t color, uint16_t bgcolor) {
+    const uint16_t *glyphs[ST7735_GLYPH_CACHE_SIZE];
+    uint32_t i, c;
+
+    for(c = 0; c < len; c++) {
+        glyphs[c] = ST7735_GetGlyph(str[c], font, color, bgcolor);
+    }
+
+    ST7735_SetAddressWindow(x, y, x+len*font.width-1, y+font.height-1);
+    for(i = 0; i < font.height; i++) {
+        for(c = 0; c < len; c++) {
+            memcpy(&rowBuffer[c * font.width], &glyphs[c][i * font.width], sizeof(uint16_t)*font.width);
+        }
+        ST7735_WritePixelData((const uint8_t*)rowBuffer, sizeof(uint16_t)*len*font.width);
+    }
+}
+
 /*
 Simpler (and probably slower) implementation:
 
@@ -216,12 +478,14 @@ static void ST7735_WriteChar(uint16_t x, uint16_t y, char ch, FontDef font, uint
 
 void ST7735_WriteString(uint16_t x, uint16_t y, const char* str, FontDef font, uint16_t color, uint16_t bgcolor) {
     ST7735_Select();
+    // After the wait for any frame still going out
+    const uint32_t start = time_us_32();
 
     while(*str) {
-        if(x + font.width >= ST7735_WIDTH) {
+        if(x + font.width >= geometry.width) {
             x = 0;
             y += font.height;
-            if(y + font.height >= ST7735_HEIGHT) {
+            if(y + font.height >= geometry.height) {
                 break;
             }
 
@@ -232,46 +496,400 @@ void ST7735_WriteString(uint16_t x, uint16_t y, const char* str, FontDef font, u
             }
         }
 
-        ST7735_WriteChar(x, y, *str, font, color, bgcolor);
-        x += font.width;
-        str++;
+        // Characters that still fit on this line
+        size_t len = 0;
+        while(str[len] && x + (len + 1) * font.width < geometry.width)
+            len++;
+
+        if(len <= ST7735_GLYPH_CACHE_SIZE && font.width * font.height <= ST7735_GLYPH_MAX_PIXELS) {
+            ST7735_WriteLine(x, y, str, len, font, color, bgcolor);
+        } else {
+            for(size_t c = 0; c < len; c++) {
+                ST7735_WriteChar(x + c * font.width, y, str[c], font, color, bgcolor);
+            }
+        }
+        x += len * font.width;
+        str += len;
+        textChars += len;
     }
 
     ST7735_Unselect();
+    textUs += time_us_32() - start;
 }
 
 void ST7735_FillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    TRACE_SCOPE(TRACE_EV_FILL_RECT);
+
     // clipping
-    if((x >= ST7735_WIDTH) || (y >= ST7735_HEIGHT)) return;
-    if((x + w - 1) >= ST7735_WIDTH) w = ST7735_WIDTH - x;
-    if((y + h - 1) >= ST7735_HEIGHT) h = ST7735_HEIGHT - y;
+    if((x >= geometry.width) || (y >= geometry.height)) return;
+    if((x + w - 1) >= geometry.width) w = geometry.width - x;
+    if((y + h - 1) >= geometry.height) h = geometry.height - y;
 
     ST7735_Select();
     ST7735_SetAddressWindow(x, y, x+w-1, y+h-1);
-
-    uint8_t data[] = { color >> 8, color & 0xFF };
     //HAL_GPIO_WritePin(ST7735_DC_GPIO_Port, ST7735_DC_Pin, GPIO_PIN_SET);
+    ST7735_WriteFill(color, (uint32_t)w*h);
+
+    ST7735_Unselect();
+}
+
+void ST7735_FillScreen(uint16_t color) {
+    ST7735_FillRectangle(0, 0, geometry.width, geometry.height, color);
+}
+
+void ST7735_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t* data) {
+    ST7735_Select();
+    ST7735_SetAddressWindow(x, y, x+w-1, y+h-1);
+    ST7735_WritePixelData(data, sizeof(uint16_t)*w*h);
+    ST7735_Unselect();
+}
+
+// Channel used to feed the SPI TX FIFO from memory, claimed on first use.
+static int dmaChannel = -1;
+
+// Set while an ST7735_DrawImageAsync transfer owns the bus
+static volatile bool asyncActive = false;
+static ST7735_DoneCallback asyncCallback;
+static void *asyncUserData;
+
+// Wait for the last DMA write to leave the bus so CS/DC can be changed.
+static void ST7735_DmaWait() {
+    if(dmaChannel < 0)
+        return;
+    dma_channel_wait_for_finish_blocking(dmaChannel);
+#if ST7735_USE_PIO
+    ST7735_PioWaitIdle();
+    return;
+#endif
+    while(spi_is_busy(SPI_PORT))
+        tight_loop_contents();
+    // Nothing was reading the RX FIFO during the transfer
+    while(spi_is_readable(SPI_PORT))
+        (void)spi_get_hw(SPI_PORT)->dr;
+    spi_get_hw(SPI_PORT)->icr = SPI_SSPICR_RORIC_BITS;
+}
 
-     DEV_Digital_Write(EPD_DC_PIN, 1);
-    for(y = h; y > 0; y--) {
-        for(x = w; x > 0; x--) {
-           // HAL_SPI_Transmit(&ST7735_SPI_PORT, data, sizeof(data), HAL_MAX_DELAY);
-            spi_write_blocking(SPI_PORT, data, sizeof(data));
+// Command list being sent by ST7735_RunCommandList, and the segment in flight
+static const ST7735_CmdList *runList;
+static uint16_t runIndex;
+
+static void ST7735_DmaWrite(const uint8_t* buff, size_t buff_size, bool repeat);
+
+static void ST7735_StartSegment(const ST7735_CmdSegment *seg) {
+    // On the SPI, DC may only change once everything before it has been sent.
+    // The PIO backend carries DC in the header so needs no wait.
+    if(seg->dc != busDc) {
+#if !ST7735_USE_PIO
+        ST7735_DmaWait();
+#endif
+        ST7735_BusDc(seg->dc);
+    }
+    ST7735_DmaWrite(seg->data, seg->len, seg->repeat);
+}
+
+// Called each time the DMA channel completes during an async transfer: start
+// the next command list segment, or release the bus and report completion.
+// Runs from the DMA IRQ, or from ST7735_WaitIdle if another draw call gets
+// there first.
+static void ST7735_AsyncStep() {
+    if(!asyncActive)
+        return;
+    if(runList && ++runIndex < runList->count) {
+        ST7735_StartSegment(&runList->segments[runIndex]);
+        return;
+    }
+    runList = NULL;
+    ST7735_DmaWait();
+    ST7735_Unselect();
+    asyncActive = false;
+    if(asyncCallback)
+        asyncCallback(asyncUserData);
+}
+
+static void ST7735_DmaIrqHandler() {
+    if(dmaChannel >= 0 && dma_channel_get_irq0_status(dmaChannel)) {
+        dma_channel_acknowledge_irq0(dmaChannel);
+        ST7735_AsyncStep();
+    }
+}
+
+static void ST7735_DmaWrite(const uint8_t* buff, size_t buff_size, bool repeat) {
+    if(dmaChannel < 0) {
+        dmaChannel = dma_claim_unused_channel(true);
+        dma_channel_set_irq0_enabled(dmaChannel, true);
+        irq_add_shared_handler(DMA_IRQ_0, ST7735_DmaIrqHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(DMA_IRQ_0, true);
+    }
+#if ST7735_USE_PIO
+    ST7735_PioStart(busDc, buff_size);
+    volatile void *dst = ST7735_PioTxFifo();
+    uint dreq = ST7735_PioDreq();
+#else
+    volatile void *dst = &spi_get_hw(SPI_PORT)->dr;
+    uint dreq = spi_get_dreq(SPI_PORT, true);
+#endif
+    dma_channel_config c = dma_channel_get_default_config(dmaChannel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, dreq);
+    if(repeat) {
+        // Wrap reads on a 2-byte boundary to send one pixel over and over
+        channel_config_set_ring(&c, false, 1);
+    }
+    dma_channel_configure(dmaChannel, &c, dst, buff, buff_size, true);
+}
+
+void ST7735_WaitIdle(void) {
+    while(asyncActive) {
+        dma_channel_wait_for_finish_blocking(dmaChannel);
+        // Step the transfer here in case the DMA IRQ cannot preempt the caller
+        uint32_t status = save_and_disable_interrupts();
+        if(asyncActive && !dma_channel_is_busy(dmaChannel)) {
+            dma_channel_acknowledge_irq0(dmaChannel);
+            ST7735_AsyncStep();
         }
+        restore_interrupts(status);
     }
+}
+
+bool ST7735_IsBusy(void) {
+    return asyncActive;
+}
+
+void ST7735_DrawImageAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t* data,
+                           ST7735_DoneCallback callback, void *user_data) {
+#if ST7735_COLOR_12BIT
+    // Pixels have to be repacked by the CPU, so there is nothing to offload
+    ST7735_DrawImage(x, y, w, h, data);
+    if(callback)
+        callback(user_data);
+    return;
+#endif
+    ST7735_Select();
+    ST7735_SetAddressWindow(x, y, x+w-1, y+h-1);
+    ST7735_BusDc(1);
+
+    // Read flash-resident images through the non-allocating XIP alias so the
+    // transfer does not evict the code the CPU keeps running from the cache.
+    uintptr_t addr = (uintptr_t)data;
+    if(addr >= XIP_BASE && addr < XIP_NOALLOC_BASE)
+        data = (const uint8_t*)(addr - XIP_BASE + XIP_NOCACHE_NOALLOC_BASE);
+
+    asyncCallback = callback;
+    asyncUserData = user_data;
+    asyncActive = true;
+    ST7735_DmaWrite(data, sizeof(uint16_t)*w*h, false);
+}
+
+void ST7735_RunCommandList(const ST7735_CmdList *list, ST7735_DoneCallback callback, void *user_data) {
+    if(!list->count)
+        return;
 
+#if ST7735_COLOR_12BIT
+    // Repacked pixels cannot be streamed by DMA, so walk the list here.
+    // Data following RAMWR is pixels; any other data is command arguments.
+    uint8_t lastCmd = ST7735_NOP;
+    ST7735_Select();
+    for(uint16_t i = 0; i < list->count; i++) {
+        const ST7735_CmdSegment *seg = &list->segments[i];
+        if(!seg->dc) {
+            lastCmd = seg->data[0];
+            ST7735_WriteCommand(lastCmd);
+        } else if(lastCmd != ST7735_RAMWR) {
+            ST7735_WriteData((uint8_t*)seg->data, seg->len);
+        } else if(seg->repeat) {
+            ST7735_WriteFill((seg->data[0] << 8) | seg->data[1], seg->len / 2);
+        } else {
+            ST7735_WritePixelData(seg->data, seg->len);
+        }
+    }
     ST7735_Unselect();
+    if(callback)
+        callback(user_data);
+    return;
+#endif
+
+    ST7735_Select();
+    asyncCallback = callback;
+    asyncUserData = user_data;
+    asyncActive = true;
+    runList = list;
+    runIndex = 0;
+    ST7735_BusDc(list->segments[0].dc);
+    ST7735_DmaWrite(runList->segments[0].data, runList->segments[0].len, runList->segments[0].repeat);
 }
 
-void ST7735_FillScreen(uint16_t color) {
-    ST7735_FillRectangle(0, 0, ST7735_WIDTH, ST7735_HEIGHT, color);
+// Decoder state for the RLE format written by tools/rle_image.py. Packets
+// may straddle lines, so the state is carried from one line to the next.
+typedef struct {
+    const uint8_t *src;
+    uint8_t count;
+    bool run;
+    uint8_t pixel[2];
+} RleDecoder;
+
+static void ST7735_RleDecode(RleDecoder *d, uint8_t *dst, uint32_t pixels) {
+    while(pixels) {
+        if(!d->count) {
+            uint8_t c = *d->src++;
+            d->run = c & 0x80;
+            d->count = (c & 0x7F) + 1;
+            if(d->run) {
+                d->pixel[0] = *d->src++;
+                d->pixel[1] = *d->src++;
+            }
+        }
+
+        uint32_t n = d->count < pixels ? d->count : pixels;
+        if(d->run) {
+            for(uint32_t i = 0; i < n; i++) {
+                dst[2 * i] = d->pixel[0];
+                dst[2 * i + 1] = d->pixel[1];
+            }
+        } else {
+            memcpy(dst, d->src, 2 * n);
+            d->src += 2 * n;
+        }
+        dst += 2 * n;
+        d->count -= n;
+        pixels -= n;
+    }
 }
 
-void ST7735_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t* data) {
+void ST7735_DrawImageCompressed(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t* data) {
+    static uint8_t lines[2][ST7735_MAX_DIM * sizeof(uint16_t)];
+    RleDecoder decoder = { .src = data };
+    uint8_t cur = 0;
+
+    if(w > ST7735_MAX_DIM)
+        return;
+
+    ST7735_Select();
+    ST7735_SetAddressWindow(x, y, x+w-1, y+h-1);
+    ST7735_BusDc(1);
+
+    // Decode each line while the previous one is still going out over DMA
+    for(uint16_t row = 0; row < h; row++) {
+        ST7735_RleDecode(&decoder, lines[cur], w);
+#if ST7735_COLOR_12BIT
+        ST7735_WritePixelData(lines[cur], sizeof(uint16_t)*w);
+        continue;
+#endif
+        if(row)
+            dma_channel_wait_for_finish_blocking(dmaChannel);
+        ST7735_DmaWrite(lines[cur], sizeof(uint16_t)*w, false);
+        cur ^= 1;
+    }
+    ST7735_DmaWait();
+
+    ST7735_Unselect();
+}
+
+void ST7735_BeginPixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
     ST7735_Select();
     ST7735_SetAddressWindow(x, y, x+w-1, y+h-1);
-    ST7735_WriteData((uint8_t*)data, sizeof(uint16_t)*w*h);
+    ST7735_BusDc(1);
+}
+
+void ST7735_WritePixels(const uint8_t* data, size_t len) {
+    ST7735_WritePixelData(data, len);
+}
+
+void ST7735_EndPixels(void) {
+    ST7735_Unselect();
+}
+
+// MADCTL bits toggled on top of ST7735_ROTATION for each quarter turn. In
+// rotation 1 logical x runs down the native y axis and logical y runs right
+// to left along native x, the same mapping as Rotation::Landscape in
+// st7735.hpp, so the panel keeps filling each window row by row.
+static const uint8_t rotationBits[4] = {
+    0,
+    ST7735_MADCTL_MV | ST7735_MADCTL_MX,
+    ST7735_MADCTL_MX | ST7735_MADCTL_MY,
+    ST7735_MADCTL_MV | ST7735_MADCTL_MY,
+};
+
+#ifdef ST7735_ROTATION_OFFSETS
+static const uint8_t rotationOffsets[4][2] = ST7735_ROTATION_OFFSETS;
+#else
+// Profiles without a measured table: assume the GRAM is centred on the panel,
+// so only an exchange of axes moves the offsets. Unverified where it is not,
+// as on the mini 160x80; the picture lands a few pixels off in turned
+// rotations, which is harmless to timing but not to drawing.
+static const uint8_t rotationOffsets[4][2] = {
+    { ST7735_XSTART, ST7735_YSTART },
+    { ST7735_YSTART, ST7735_XSTART },
+    { ST7735_XSTART, ST7735_YSTART },
+    { ST7735_YSTART, ST7735_XSTART },
+};
+#endif
+
+void ST7735_SetRotation(uint8_t rotation) {
+    rotation &= 3;
+    uint8_t madctl = ST7735_ROTATION ^ rotationBits[rotation];
+
+    ST7735_Select();
+    ST7735_WriteCommand(ST7735_MADCTL);
+    ST7735_WriteData(&madctl, sizeof(madctl));
     ST7735_Unselect();
+
+    geometry = (rotation & 1)
+        ? (ST7735_Geometry){ ST7735_HEIGHT, ST7735_WIDTH, 0, 0 }
+        : (ST7735_Geometry){ ST7735_WIDTH, ST7735_HEIGHT, 0, 0 };
+    geometry.xstart = rotationOffsets[rotation][0];
+    geometry.ystart = rotationOffsets[rotation][1];
+    currentRotation = rotation;
+}
+
+ST7735_Geometry ST7735_GetGeometry(void) {
+    return geometry;
+}
+
+void ST7735_MeasureRotations(uint16_t w, uint16_t h, uint32_t screenUs[4], uint32_t rectUs[4]) {
+    const uint8_t saved = currentRotation;
+    for(uint8_t rotation = 0; rotation < 4; rotation++) {
+        ST7735_SetRotation(rotation);
+
+        uint32_t start = time_us_32();
+        ST7735_FillScreen(ST7735_BLACK);
+        ST7735_WaitIdle();
+        screenUs[rotation] = time_us_32() - start;
+
+        start = time_us_32();
+        ST7735_FillRectangle(0, 0, w, h, ST7735_WHITE);
+        ST7735_WaitIdle();
+        rectUs[rotation] = time_us_32() - start;
+    }
+    ST7735_SetRotation(saved);
+    ST7735_FillScreen(ST7735_BLACK);
+}
+
+void ST7735_MeasureBus(ST7735_BusTimes *times) {
+    static ST7735_CmdList fillList;
+    const uint32_t pixels = (uint32_t)geometry.width * geometry.height;
+    times->bytes = ST7735_COLOR_12BIT ? (pixels * 3 + 1) / 2 : pixels * 2;
+
+    ST7735_WaitIdle();
+    uint32_t start = time_us_32();
+    ST7735_FillScreen(ST7735_WHITE);
+    times->cpuFillUs = time_us_32() - start;
+
+    // One window and one repeated pixel, as the game's frames are sent
+    ST7735_CmdListInit(&fillList);
+    fillList.geometry = geometry;
+    ST7735_CmdListFillRectangle(&fillList, 0, 0, geometry.width, geometry.height, ST7735_BLUE);
+    start = time_us_32();
+    ST7735_RunCommandList(&fillList, NULL, NULL);
+    ST7735_WaitIdle();
+    times->dmaFillUs = time_us_32() - start;
+
+    memset(rowBuffer, 0, sizeof(uint16_t) * geometry.width);
+    start = time_us_32();
+    ST7735_BeginPixels(0, 0, geometry.width, geometry.height);
+    for(uint16_t row = 0; row < geometry.height; row++)
+        ST7735_WritePixels((const uint8_t*)rowBuffer, sizeof(uint16_t) * geometry.width);
+    ST7735_EndPixels();
+    times->writeUs = time_us_32() - start;
 }
 
 void ST7735_InvertColors(bool invert) {
@@ -280,4 +898,56 @@ void ST7735_InvertColors(bool invert) {
     ST7735_Unselect();
 }
 
+void ST7735_SetScrollArea(uint16_t top, uint16_t scroll, uint16_t bottom) {
+    uint8_t data[] = { top >> 8, top & 0xFF, scroll >> 8, scroll & 0xFF, bottom >> 8, bottom & 0xFF };
+    ST7735_Select();
+    ST7735_WriteCommand(ST7735_VSCRDEF);
+    ST7735_WriteData(data, sizeof(data));
+    ST7735_Unselect();
+}
+
+void ST7735_SetScrollStart(uint16_t line) {
+    uint8_t data[] = { line >> 8, line & 0xFF };
+    ST7735_Select();
+    ST7735_WriteCommand(ST7735_VSCSAD);
+    ST7735_WriteData(data, sizeof(data));
+    ST7735_Unselect();
+}
+
+// Display mode changes are encoded by the same code as a frame's command
+// list, so the bytes sent are the ones the encoder produces on the host.
+static ST7735_CmdList modeList;
+
+void ST7735_SetPartialMode(uint16_t first, uint16_t count) {
+    ST7735_CmdListInit(&modeList);
+    ST7735_CmdListPartial(&modeList, first, count);
+    ST7735_RunCommandList(&modeList, NULL, NULL);
+    ST7735_WaitIdle();
+}
+
+void ST7735_SetNormalMode(void) {
+    ST7735_CmdListInit(&modeList);
+    ST7735_CmdListNormal(&modeList);
+    ST7735_RunCommandList(&modeList, NULL, NULL);
+    ST7735_WaitIdle();
+}
+
+void ST7735_Sleep(bool sleep) {
+    ST7735_Select();
+    if(sleep) {
+        ST7735_WriteCommand(ST7735_DISPOFF);
+        ST7735_WriteCommand(ST7735_SLPIN);
+        ST7735_Unselect();
+        // SLPOUT must not follow sooner than 120 ms; callers wake far later
+        return;
+    }
+    ST7735_WriteCommand(ST7735_SLPOUT);
+    ST7735_Unselect();
+    // The booster and oscillator need 120 ms before the next command
+    sleep_ms(ST7735_WAKE_MILLIS);
+    ST7735_Select();
+    ST7735_WriteCommand(ST7735_DISPON);
+    ST7735_Unselect();
+}
+
 
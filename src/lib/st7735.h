@@ -4,6 +4,7 @@
 
 #include "fonts.h"
 #include <stdbool.h>
+#include <stddef.h>
 
 #define ST7735_MADCTL_MY  0x80
 #define ST7735_MADCTL_MX  0x40
@@ -19,6 +20,23 @@
 #define ST7735_DC_Pin        GPIO_PIN_9
 #define ST7735_DC_GPIO_Port  GPIOA
 
+// Run the panel in 12-bit colour (RGB444, 3 bytes per 2 pixels) instead of
+// 16-bit. The API still takes RGB565 and pixels are repacked on the way out,
+// cutting bus traffic by a quarter. DMA-driven calls fall back to the CPU.
+#ifndef ST7735_COLOR_12BIT
+#define ST7735_COLOR_12BIT 0
+#endif
+
+// Drive CLK, MOSI and DC from a PIO state machine instead of the SPI
+// peripheral, at a clock independent of the SPI dividers (st7735_bus.pio).
+// 'd' on the console measures the bus a build uses.
+#ifndef ST7735_USE_PIO
+#define ST7735_USE_PIO 0
+#endif
+#ifndef ST7735_PIO_BAUD
+#define ST7735_PIO_BAUD (24 * 1000 * 1000)
+#endif
+
 // AliExpress/eBay 1.8" display, default orientation
 /*
 #define ST7735_IS_160X128 1
@@ -147,6 +165,11 @@
 #define ST7735_HEIGHT 160 
 //#define ST7735_ROTATION (ST7735_MADCTL_MX | ST7735_MADCTL_MY | ST7735_MADCTL_BGR)
 #define ST7735_ROTATION ( ST7735_MADCTL_BGR)
+// The RAM offsets after an ST7735_SetRotation quarter turn have not been
+// measured on this panel, so it takes the centred-GRAM guess in st7735.c.
+// Only the 'o' rotation timing turns it; the game maps landscape in software
+// and keeps the native rotation. Define ST7735_ROTATION_OFFSETS as
+// { { xstart, ystart } x 4 } once a board confirms them.
 
 // mini 160x80, rotate left
 /*
@@ -189,8 +212,10 @@
 #define ST7735_RAMRD   0x2E
 
 #define ST7735_PTLAR   0x30
+#define ST7735_VSCRDEF 0x33
 #define ST7735_COLMOD  0x3A
 #define ST7735_MADCTL  0x36
+#define ST7735_VSCSAD  0x37
 
 #define ST7735_FRMCTR1 0xB1
 #define ST7735_FRMCTR2 0xB2
@@ -226,6 +251,30 @@
 #define ST7735_WHITE   0xFFFF
 #define ST7735_COLOR565(r, g, b) (((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xF8) >> 3))
 
+// Lines of frame memory along the vertical scroll axis (162 on the ST7735S)
+#ifndef ST7735_GRAM_LINES
+#define ST7735_GRAM_LINES 162
+#endif
+
+// Longer side of the panel, for buffers that must hold a row in any rotation
+#define ST7735_MAX_DIM (ST7735_WIDTH > ST7735_HEIGHT ? ST7735_WIDTH : ST7735_HEIGHT)
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint16_t xstart;
+    uint16_t ystart;
+} ST7735_Geometry;
+
+// Number of glyphs kept pre-rendered by ST7735_WriteString, and the largest
+// glyph (in pixels) a cache entry can hold. Each entry costs 2 bytes per pixel.
+#ifndef ST7735_GLYPH_CACHE_SIZE
+#define ST7735_GLYPH_CACHE_SIZE 8
+#endif
+#define ST7735_GLYPH_MAX_PIXELS (16 * 26)
+
+typedef void (*ST7735_DoneCallback)(void *user_data);
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -233,15 +282,88 @@ extern "C" {
 void ST7735_Unselect();
 
 void ST7735_Init(void);
+// Run a command list in the init_cmds format: count, then per command the
+// opcode, argument count (| 0x80 if a delay byte follows) and arguments.
+void ST7735_WriteCommandList(const uint8_t *list);
 void ST7735_DrawPixel(uint16_t x, uint16_t y, uint16_t color);
 void ST7735_WriteString(uint16_t x, uint16_t y, const char *str, FontDef font,
                         uint16_t color, uint16_t bgcolor);
+// Glyph cache lookups, and the characters ST7735_WriteString has drawn and
+// the time it took, since boot or the last reset.
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t chars;
+    uint32_t us;
+} ST7735_TextStats;
+void ST7735_GetTextStats(ST7735_TextStats *stats);
+void ST7735_ResetTextStats(void);
 void ST7735_FillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
                           uint16_t color);
 void ST7735_FillScreen(uint16_t color);
 void ST7735_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
                       const uint8_t *data);
+// Draw an image encoded by tools/rle_image.py
+void ST7735_DrawImageCompressed(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                                const uint8_t *data);
+// Start sending an image by DMA and return straight away. The callback runs
+// from the DMA IRQ once the last pixel has left the SPI. Any other draw call
+// waits for the transfer to finish first.
+void ST7735_DrawImageAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                           const uint8_t *data, ST7735_DoneCallback callback,
+                           void *user_data);
+// Send a list built with st7735_cmdlist.h. Returns once the first segment is
+// queued; the list must stay untouched until the callback runs.
+struct ST7735_CmdList;
+void ST7735_RunCommandList(const struct ST7735_CmdList *list,
+                           ST7735_DoneCallback callback, void *user_data);
+bool ST7735_IsBusy(void);
+void ST7735_WaitIdle(void);
 void ST7735_InvertColors(bool invert);
+// Turn the display off and put the controller into sleep (SLPIN), or wake it
+// again. Frame memory is kept, so the picture returns as it was. Waking
+// blocks for ST7735_WAKE_MILLIS.
+#define ST7735_WAKE_MILLIS 120
+void ST7735_Sleep(bool sleep);
+// Vertical scrolling, in frame memory lines along the panel's native y axis
+// (logical x after a quarter-turn rotation). Define a scrolling band of
+// scroll lines between fixed top and bottom areas, which must add up to
+// ST7735_GRAM_LINES, then move the line shown at the top of the band.
+void ST7735_SetScrollArea(uint16_t top, uint16_t scroll, uint16_t bottom);
+void ST7735_SetScrollStart(uint16_t line);
+// Partial mode: only count panel lines from first (native y axis, whatever
+// the rotation) are refreshed and the rest of the panel is blanked, which
+// saves the driver work and power when nothing else changes. Frame memory
+// outside the band may still be written and shows again in normal mode.
+void ST7735_SetPartialMode(uint16_t first, uint16_t count);
+void ST7735_SetNormalMode(void);
+// Turn the panel by rotation quarter turns clockwise (0-3) through MADCTL.
+// All drawing calls take coordinates in the rotated space afterwards, and
+// ST7735_GetGeometry reports its size.
+void ST7735_SetRotation(uint8_t rotation);
+ST7735_Geometry ST7735_GetGeometry(void);
+// Time a full-screen fill and a w x h fill at the top left in each rotation,
+// to check that MADCTL turns cost nothing over the native scan. Leaves the
+// screen black in the rotation it found.
+void ST7735_MeasureRotations(uint16_t w, uint16_t h, uint32_t screenUs[4], uint32_t rectUs[4]);
+// Time a screen of pixels on whichever bus is built in: filled by the CPU
+// (ST7735_FillScreen), filled by DMA from a command list, and written from
+// memory a row at a time by the CPU. bytes is what each puts on the wire.
+// In 12-bit colour the command list is walked by the CPU too. Leaves the
+// screen black.
+typedef struct {
+    uint32_t bytes;
+    uint32_t cpuFillUs;
+    uint32_t dmaFillUs;
+    uint32_t writeUs;
+} ST7735_BusTimes;
+void ST7735_MeasureBus(ST7735_BusTimes *times);
+
+// Stream raw big-endian RGB565 pixels into a window. Begin selects the panel
+// and sets the window, Write may be called any number of times, End releases.
+void ST7735_BeginPixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void ST7735_WritePixels(const uint8_t *data, size_t len);
+void ST7735_EndPixels(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,179 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __ST7735_HPP__
+#define __ST7735_HPP__
+
+// Compile-time specialised front end for the ST7735 driver (C++17).
+//
+// Driver<Panel, Bus, Rot> fixes the panel geometry and orientation at compile
+// time. Coordinates are given in the rotated (logical) space and mapped to
+// the panel's native space with constexpr arithmetic, so for constant
+// arguments the mapping folds away entirely. The panel-specific tail of the
+// init sequence is built as a constexpr command list and checked with
+// static_assert before it can ever reach the panel.
+//
+// With RotateInPanel the rotation is set in MADCTL instead, so the controller
+// takes logical coordinates directly and walks every window in its own
+// row-major order. A wide rectangle such as the pong divider then stays one
+// window rather than being mapped to a tall, thin one.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "st7735.h"
+
+namespace st7735 {
+
+// Panel profiles: native (unrotated) size, RAM offsets and MADCTL bits
+struct Mini160x80 {
+    static constexpr uint16_t width = 80;
+    static constexpr uint16_t height = 160;
+    static constexpr uint16_t xstart = 24;
+    static constexpr uint16_t ystart = 0;
+    static constexpr uint8_t madctl = ST7735_MADCTL_BGR;
+};
+
+struct Generic128x160 {
+    static constexpr uint16_t width = 128;
+    static constexpr uint16_t height = 160;
+    static constexpr uint16_t xstart = 0;
+    static constexpr uint16_t ystart = 0;
+    static constexpr uint8_t madctl = ST7735_MADCTL_MX | ST7735_MADCTL_MY;
+};
+
+struct Generic128x128 {
+    static constexpr uint16_t width = 128;
+    static constexpr uint16_t height = 128;
+    static constexpr uint16_t xstart = 2;
+    static constexpr uint16_t ystart = 3;
+    static constexpr uint8_t madctl = ST7735_MADCTL_MX | ST7735_MADCTL_MY | ST7735_MADCTL_BGR;
+};
+
+// Landscape turns the panel a quarter clockwise: logical x runs down the
+// native y axis and logical y runs right to left along native x.
+enum class Rotation { Portrait, Landscape, PortraitFlipped, LandscapeFlipped };
+
+struct Rect {
+    uint16_t x, y, w, h;
+};
+
+// Walk a list in the init_cmds format and check that it is well formed: the
+// declared command count matches, no command reads past the end, and the
+// list ends exactly on its last byte.
+constexpr bool validCommandList(const uint8_t *list, size_t size) {
+    if(size == 0)
+        return false;
+    size_t pos = 1;
+    for(uint8_t n = list[0]; n > 0; n--) {
+        if(pos + 2 > size)
+            return false;
+        const uint8_t args = list[pos + 1];
+        pos += 2 + (args & 0x7F) + ((args & 0x80) ? 1 : 0);
+        if(pos > size)
+            return false;
+    }
+    return pos == size;
+}
+
+template <typename Panel, Rotation Rot>
+struct Geometry {
+    static constexpr bool swapped = Rot == Rotation::Landscape || Rot == Rotation::LandscapeFlipped;
+    static constexpr uint16_t width = swapped ? Panel::height : Panel::width;
+    static constexpr uint16_t height = swapped ? Panel::width : Panel::height;
+
+    static constexpr Rect toPhysical(Rect r) {
+        switch(Rot) {
+        case Rotation::Landscape:
+            return { uint16_t(Panel::width - r.y - r.h), r.x, r.h, r.w };
+        case Rotation::PortraitFlipped:
+            return { uint16_t(Panel::width - r.x - r.w), uint16_t(Panel::height - r.y - r.h), r.w, r.h };
+        case Rotation::LandscapeFlipped:
+            return { r.y, uint16_t(Panel::height - r.x - r.w), r.h, r.w };
+        default:
+            return r;
+        }
+    }
+
+    // Clip in logical space so the mapping never sees negative extents
+    static constexpr Rect clip(Rect r) {
+        if(r.x >= width || r.y >= height)
+            return { 0, 0, 0, 0 };
+        if(r.x + r.w > width)
+            r.w = width - r.x;
+        if(r.y + r.h > height)
+            r.h = height - r.y;
+        return r;
+    }
+};
+
+// Bus that goes through the C driver, so the SPI/PIO backend, 12-bit mode
+// and outstanding DMA transfers are all honoured. Takes native coordinates.
+struct DriverBus {
+    static void init() { ST7735_Init(); }
+    static void commands(const uint8_t *list) { ST7735_WriteCommandList(list); }
+    static void fill(Rect r, uint16_t color) { ST7735_FillRectangle(r.x, r.y, r.w, r.h, color); }
+    static void rotate(Rotation rot) { ST7735_SetRotation(uint8_t(rot)); }
+};
+
+template <typename Panel, typename Bus, Rotation Rot = Rotation::Portrait, bool RotateInPanel = false>
+class Driver {
+public:
+    using geometry = Geometry<Panel, Rot>;
+    static constexpr uint16_t width = geometry::width;
+    static constexpr uint16_t height = geometry::height;
+
+    // MADCTL and the full-panel window for this profile
+    static constexpr std::array<uint8_t, 16> profileCommands = {
+        3,
+        ST7735_MADCTL, 1, Panel::madctl,
+        ST7735_CASET, 4,
+            0x00, uint8_t(Panel::xstart), 0x00, uint8_t(Panel::xstart + Panel::width - 1),
+        ST7735_RASET, 4,
+            0x00, uint8_t(Panel::ystart), 0x00, uint8_t(Panel::ystart + Panel::height - 1),
+    };
+    static_assert(validCommandList(profileCommands.data(), profileCommands.size()),
+                  "malformed profile command list");
+    static_assert(Panel::xstart + Panel::width - 1 <= 0xFF && Panel::ystart + Panel::height - 1 <= 0xFF,
+                  "window does not fit the 8-bit address registers");
+
+    static void init() {
+        Bus::init();
+        Bus::commands(profileCommands.data());
+        if constexpr(RotateInPanel)
+            Bus::rotate(Rot);
+    }
+
+    static constexpr bool rotatesInPanel = RotateInPanel;
+
+    // A logical rectangle clipped to the screen and given in the coordinates
+    // the controller takes: logical with RotateInPanel, native without. Empty
+    // when nothing is left.
+    static constexpr Rect toPanel(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+        const Rect r = geometry::clip({ x, y, w, h });
+        if(!r.w || !r.h)
+            return { 0, 0, 0, 0 };
+        if constexpr(RotateInPanel)
+            return r;
+        else
+            return geometry::toPhysical(r);
+    }
+
+    static void fillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+        const Rect r = toPanel(x, y, w, h);
+        if(!r.w || !r.h)
+            return;
+        Bus::fill(r, color);
+    }
+
+    static void drawPixel(uint16_t x, uint16_t y, uint16_t color) {
+        fillRectangle(x, y, 1, 1, color);
+    }
+
+    static void fillScreen(uint16_t color) {
+        fillRectangle(0, 0, width, height, color);
+    }
+};
+
+} // namespace st7735
+
+#endif // __ST7735_HPP__
@@ -0,0 +1,119 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "st7735_cmdlist.h"
+#include <string.h>
+
+void ST7735_CmdListInit(ST7735_CmdList *list) {
+    list->geometry = (ST7735_Geometry){ ST7735_WIDTH, ST7735_HEIGHT, ST7735_XSTART, ST7735_YSTART };
+    list->count = 0;
+    list->used = 0;
+    list->overflow = false;
+}
+
+static uint8_t* ST7735_CmdListAlloc(ST7735_CmdList *list, size_t len) {
+    uint16_t start = (list->used + 1) & ~1;
+    if(start + len > ST7735_CMDLIST_MAX_BYTES) {
+        list->overflow = true;
+        return NULL;
+    }
+    list->used = start + len;
+    return &list->bytes[start];
+}
+
+static bool ST7735_CmdListAppend(ST7735_CmdList *list, const uint8_t *data, uint32_t len, bool dc, bool repeat) {
+    if(list->count >= ST7735_CMDLIST_MAX_SEGMENTS) {
+        list->overflow = true;
+        return false;
+    }
+    ST7735_CmdSegment *seg = &list->segments[list->count++];
+    seg->data = data;
+    seg->len = len;
+    seg->dc = dc;
+    seg->repeat = repeat;
+    return true;
+}
+
+bool ST7735_CmdListCommand(ST7735_CmdList *list, uint8_t cmd, const uint8_t *args, size_t num_args) {
+    if(list->count + (num_args ? 2 : 1) > ST7735_CMDLIST_MAX_SEGMENTS) {
+        list->overflow = true;
+        return false;
+    }
+    uint8_t *buf = ST7735_CmdListAlloc(list, 1 + num_args);
+    if(!buf)
+        return false;
+
+    buf[0] = cmd;
+    ST7735_CmdListAppend(list, &buf[0], 1, false, false);
+    if(num_args) {
+        memcpy(&buf[1], args, num_args);
+        ST7735_CmdListAppend(list, &buf[1], num_args, true, false);
+    }
+    return true;
+}
+
+// Drop a partly appended primitive so a full list never ends mid-window
+static bool ST7735_CmdListRollback(ST7735_CmdList *list, uint16_t count, uint16_t used) {
+    list->count = count;
+    list->used = used;
+    return false;
+}
+
+bool ST7735_CmdListWindow(ST7735_CmdList *list, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    const ST7735_Geometry *g = &list->geometry;
+    const uint8_t cols[] = { 0x00, x + g->xstart, 0x00, x + w - 1 + g->xstart };
+    const uint8_t rows[] = { 0x00, y + g->ystart, 0x00, y + h - 1 + g->ystart };
+    const uint16_t count = list->count, used = list->used;
+
+    if(ST7735_CmdListCommand(list, ST7735_CASET, cols, sizeof(cols))
+        && ST7735_CmdListCommand(list, ST7735_RASET, rows, sizeof(rows))
+        && ST7735_CmdListCommand(list, ST7735_RAMWR, NULL, 0))
+        return true;
+    return ST7735_CmdListRollback(list, count, used);
+}
+
+bool ST7735_CmdListPartial(ST7735_CmdList *list, uint16_t first, uint16_t count) {
+    if(first >= ST7735_HEIGHT || count == 0)
+        return true;
+    if(first + count > ST7735_HEIGHT)
+        count = ST7735_HEIGHT - first;
+
+    const uint16_t start = first + ST7735_YSTART;
+    const uint16_t end = start + count - 1;
+    const uint8_t area[] = { start >> 8, start & 0xFF, end >> 8, end & 0xFF };
+    const uint16_t used = list->used, segments = list->count;
+
+    if(ST7735_CmdListCommand(list, ST7735_PTLAR, area, sizeof(area))
+        && ST7735_CmdListCommand(list, ST7735_PTLON, NULL, 0))
+        return true;
+    return ST7735_CmdListRollback(list, segments, used);
+}
+
+bool ST7735_CmdListNormal(ST7735_CmdList *list) {
+    return ST7735_CmdListCommand(list, ST7735_NORON, NULL, 0);
+}
+
+bool ST7735_CmdListFillRectangle(ST7735_CmdList *list, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    // clipping, as ST7735_FillRectangle
+    const ST7735_Geometry *g = &list->geometry;
+    if((x >= g->width) || (y >= g->height)) return true;
+    if((x + w - 1) >= g->width) w = g->width - x;
+    if((y + h - 1) >= g->height) h = g->height - y;
+    if(!w || !h) return true;
+
+    const uint16_t count = list->count, used = list->used;
+    if(!ST7735_CmdListWindow(list, x, y, w, h))
+        return false;
+    uint8_t *pattern = ST7735_CmdListAlloc(list, 2);
+    if(!pattern || !ST7735_CmdListAppend(list, pattern, sizeof(uint16_t)*w*h, true, true))
+        return ST7735_CmdListRollback(list, count, used);
+    pattern[0] = color >> 8;
+    pattern[1] = color & 0xFF;
+    return true;
+}
+
+bool ST7735_CmdListImage(ST7735_CmdList *list, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *data) {
+    const uint16_t count = list->count, used = list->used;
+    if(ST7735_CmdListWindow(list, x, y, w, h)
+        && ST7735_CmdListAppend(list, data, sizeof(uint16_t)*w*h, true, false))
+        return true;
+    return ST7735_CmdListRollback(list, count, used);
+}
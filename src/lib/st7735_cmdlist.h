@@ -0,0 +1,67 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __ST7735_CMDLIST_H__
+#define __ST7735_CMDLIST_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "st7735.h"
+
+// A frame's worth of panel traffic, recorded up front and then sent in one go
+// by ST7735_RunCommandList. The list is a sequence of segments, each a run of
+// bytes sent with DC low (command) or high (data). Repeated segments send a
+// 2-byte pattern len/2 times, which is how solid fills are encoded without
+// storing a pixel per pixel. The encoder touches no hardware.
+
+#ifndef ST7735_CMDLIST_MAX_SEGMENTS
+#define ST7735_CMDLIST_MAX_SEGMENTS 96
+#endif
+#ifndef ST7735_CMDLIST_MAX_BYTES
+#define ST7735_CMDLIST_MAX_BYTES 256
+#endif
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t len;
+    bool dc;
+    bool repeat;
+} ST7735_CmdSegment;
+
+typedef struct ST7735_CmdList {
+    // Panel size and offsets the list is encoded for. Init sets the default
+    // rotation; use ST7735_GetGeometry() after ST7735_SetRotation.
+    ST7735_Geometry geometry;
+    ST7735_CmdSegment segments[ST7735_CMDLIST_MAX_SEGMENTS];
+    uint16_t count;
+    // Command arguments and fill patterns. Kept 2-byte aligned so a pattern
+    // can be read by the DMA as a 2-byte ring.
+    uint8_t bytes[ST7735_CMDLIST_MAX_BYTES] __attribute__((aligned(4)));
+    uint16_t used;
+    // Set when an append did not fit. The list is still valid up to there.
+    bool overflow;
+} ST7735_CmdList;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void ST7735_CmdListInit(ST7735_CmdList *list);
+bool ST7735_CmdListCommand(ST7735_CmdList *list, uint8_t cmd,
+                           const uint8_t *args, size_t num_args);
+bool ST7735_CmdListWindow(ST7735_CmdList *list, uint16_t x, uint16_t y,
+                          uint16_t w, uint16_t h);
+bool ST7735_CmdListFillRectangle(ST7735_CmdList *list, uint16_t x, uint16_t y,
+                                 uint16_t w, uint16_t h, uint16_t color);
+bool ST7735_CmdListImage(ST7735_CmdList *list, uint16_t x, uint16_t y,
+                         uint16_t w, uint16_t h, const uint8_t *data);
+// Restrict refresh to count panel lines starting at first (PTLAR, PTLON), or
+// go back to refreshing the whole panel (NORON). Lines run along the native
+// y axis whatever the rotation, and the band is clipped to the panel.
+bool ST7735_CmdListPartial(ST7735_CmdList *list, uint16_t first, uint16_t count);
+bool ST7735_CmdListNormal(ST7735_CmdList *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ST7735_CMDLIST_H__
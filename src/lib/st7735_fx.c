@@ -0,0 +1,116 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "st7735_fx.h"
+#include "st7735.h"
+#include "pico/stdlib.h"
+
+typedef enum {
+    FX_MOTION_NONE,
+    FX_MOTION_SHAKE,
+    FX_MOTION_SCROLL,
+} FxMotion;
+
+// Flash: remaining inversion toggles and when the next one is due
+static uint8_t flashToggles;
+static uint32_t flashPeriod;
+static uint32_t flashNext;
+static bool inverted;
+
+// Shake or scroll, relative to base, the resting scroll start
+static FxMotion motion;
+static uint32_t motionStart;
+static uint32_t motionDuration;
+static int16_t motionSize;
+static uint16_t base;
+static uint16_t shown;
+static bool shakeSign;
+static bool areaDefined;
+
+static uint32_t ST7735_FxNow(void) {
+    return to_ms_since_boot(get_absolute_time());
+}
+
+static uint16_t ST7735_FxWrap(int32_t line) {
+    line %= ST7735_GRAM_LINES;
+    return line < 0 ? line + ST7735_GRAM_LINES : line;
+}
+
+static void ST7735_FxShow(int32_t line) {
+    uint16_t wrapped = ST7735_FxWrap(line);
+    if(wrapped == shown)
+        return;
+
+    if(!areaDefined) {
+        // Whole frame memory scrolls, no fixed areas
+        ST7735_SetScrollArea(0, ST7735_GRAM_LINES, 0);
+        areaDefined = true;
+    }
+    ST7735_SetScrollStart(wrapped);
+    shown = wrapped;
+}
+
+void ST7735_FxFlash(uint8_t count, uint32_t period_ms) {
+    // An odd toggle count would leave the picture inverted
+    flashToggles = count * 2;
+    flashPeriod = period_ms;
+    flashNext = ST7735_FxNow();
+}
+
+void ST7735_FxShake(uint8_t amplitude, uint32_t duration_ms) {
+    if(motion == FX_MOTION_SCROLL)
+        base = shown;
+    motion = FX_MOTION_SHAKE;
+    motionStart = ST7735_FxNow();
+    motionDuration = duration_ms ? duration_ms : 1;
+    motionSize = amplitude;
+}
+
+void ST7735_FxScroll(int16_t lines, uint32_t duration_ms) {
+    if(motion == FX_MOTION_SCROLL)
+        base = shown;
+    motion = FX_MOTION_SCROLL;
+    motionStart = ST7735_FxNow();
+    motionDuration = duration_ms ? duration_ms : 1;
+    motionSize = lines;
+}
+
+void ST7735_FxReset(void) {
+    flashToggles = 0;
+    if(inverted) {
+        ST7735_InvertColors(false);
+        inverted = false;
+    }
+    motion = FX_MOTION_NONE;
+    base = 0;
+    if(areaDefined)
+        ST7735_FxShow(0);
+}
+
+bool ST7735_FxStep(void) {
+    const uint32_t now = ST7735_FxNow();
+
+    if(flashToggles && (int32_t)(now - flashNext) >= 0) {
+        inverted = !inverted;
+        ST7735_InvertColors(inverted);
+        flashToggles--;
+        flashNext = now + flashPeriod;
+    }
+
+    if(motion != FX_MOTION_NONE) {
+        const uint32_t elapsed = now - motionStart;
+        if(elapsed >= motionDuration) {
+            if(motion == FX_MOTION_SCROLL)
+                base = ST7735_FxWrap(base + motionSize);
+            motion = FX_MOTION_NONE;
+            ST7735_FxShow(base);
+        } else if(motion == FX_MOTION_SHAKE) {
+            // Alternate sides every step, shrinking linearly to rest
+            int32_t offset = motionSize - (int32_t)(motionSize * elapsed / motionDuration);
+            shakeSign = !shakeSign;
+            ST7735_FxShow(base + (shakeSign ? offset : -offset));
+        } else {
+            ST7735_FxShow(base + (int32_t)motionSize * (int32_t)elapsed / (int32_t)motionDuration);
+        }
+    }
+
+    return flashToggles || motion != FX_MOTION_NONE;
+}
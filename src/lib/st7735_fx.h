@@ -0,0 +1,44 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __ST7735_FX_H__
+#define __ST7735_FX_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Full-screen effects done by the controller rather than by repainting:
+// flashes toggle display inversion and shakes and scroll transitions move
+// the vertical scroll start. Each step costs a command and at most two data
+// bytes, against 25,600 bytes for a full-screen fill.
+//
+// Effects only record their timing. ST7735_FxStep() issues the commands
+// that are due and should be called once per frame from the thread that
+// draws, so the SPI is never touched from an interrupt. A flash can run
+// alongside a shake or scroll; starting a shake or scroll replaces the
+// previous one.
+//
+// Scrolling moves along the panel's native y axis, which is horizontal in
+// the landscape game. Frame memory is a ring of ST7735_GRAM_LINES lines, so
+// content scrolled off one edge comes back in at the other, along with any
+// lines the panel never shows (two on the 80x160 module).
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Invert the display count times, each for period_ms
+void ST7735_FxFlash(uint8_t count, uint32_t period_ms);
+// Jolt the picture by up to amplitude lines, settling over duration_ms
+void ST7735_FxShake(uint8_t amplitude, uint32_t duration_ms);
+// Scroll by lines (negative for the other way) over duration_ms. A scroll
+// of ST7735_GRAM_LINES wraps the picture all the way round.
+void ST7735_FxScroll(int16_t lines, uint32_t duration_ms);
+// Stop every effect and put the picture back in place
+void ST7735_FxReset(void);
+// Issue the commands due now. Returns true while an effect is running.
+bool ST7735_FxStep(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ST7735_FX_H__
@@ -0,0 +1,63 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "st7735_game.h"
+#include "st7735.hpp"
+#include "st7735_cmdlist.h"
+
+// Game-space rectangles are mapped onto the panel in its native rotation.
+// Rotating in MADCTL instead (RotateInPanel) needs the RAM offsets of the
+// turned panel, which have not been measured on this profile yet.
+constexpr auto GameRotation = st7735::Rotation::Landscape;
+using Display = st7735::Driver<st7735::Mini160x80, st7735::DriverBus, GameRotation, false>;
+static_assert(Display::toPanel(0, 0, 10, 30).w == 30 && Display::toPanel(0, 0, 10, 30).x == 50,
+              "paddle does not map onto the native panel");
+
+static_assert(Display::width == GAME_WIDTH && Display::height == GAME_HEIGHT,
+              "game size does not match the panel profile");
+static_assert(st7735::Mini160x80::width == ST7735_WIDTH && st7735::Mini160x80::height == ST7735_HEIGHT
+              && st7735::Mini160x80::xstart == ST7735_XSTART && st7735::Mini160x80::ystart == ST7735_YSTART,
+              "panel profile does not match the one selected in st7735.h");
+
+void GameDisplay_Init(void) {
+    Display::init();
+}
+
+void GameDisplay_FillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    Display::fillRectangle(x, y, w, h, color);
+}
+
+void GameDisplay_FillScreen(uint16_t color) {
+    Display::fillScreen(color);
+}
+
+void GameDisplay_DrawPanelImage(const uint8_t *rle, uint16_t w, uint16_t h) {
+    if constexpr(Display::rotatesInPanel)
+        ST7735_SetRotation(uint8_t(st7735::Rotation::Portrait));
+    ST7735_DrawImageCompressed(0, 0, w, h, rle);
+    if constexpr(Display::rotatesInPanel)
+        ST7735_SetRotation(uint8_t(GameRotation));
+}
+
+// Encoded in the controller's geometry, with rectangles mapped by toPanel
+static ST7735_CmdList frame;
+
+void GameDisplay_BeginFrame(void) {
+    // The last frame may still be streaming from the list
+    ST7735_WaitIdle();
+    ST7735_CmdListInit(&frame);
+    frame.geometry = ST7735_GetGeometry();
+}
+
+void GameDisplay_FrameFill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    const st7735::Rect r = Display::toPanel(x, y, w, h);
+    if(!r.w || !r.h)
+        return;
+    if(ST7735_CmdListFillRectangle(&frame, r.x, r.y, r.w, r.h, color))
+        return;
+    GameDisplay_EndFrame();
+    GameDisplay_BeginFrame();
+    ST7735_CmdListFillRectangle(&frame, r.x, r.y, r.w, r.h, color);
+}
+
+void GameDisplay_EndFrame(void) {
+    ST7735_RunCommandList(&frame, nullptr, nullptr);
+}
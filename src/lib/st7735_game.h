@@ -0,0 +1,39 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __ST7735_GAME_H__
+#define __ST7735_GAME_H__
+
+#include <stdint.h>
+
+// C interface to the game's display, in landscape game coordinates: x runs
+// left to right from the user's paddle to the AI's, y runs top to bottom.
+// Backed by the st7735::Driver template in st7735_game.cpp, which checks
+// these sizes against the panel profile at compile time.
+
+#define GAME_WIDTH  160
+#define GAME_HEIGHT 80
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void GameDisplay_Init(void);
+void GameDisplay_FillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                               uint16_t color);
+void GameDisplay_FillScreen(uint16_t color);
+// Draw an image encoded by tools/rle_image.py at the top left of the panel
+// in its native portrait orientation, such as a full-screen splash.
+void GameDisplay_DrawPanelImage(const uint8_t *rle, uint16_t w, uint16_t h);
+// A frame's fills, recorded into one ST7735 command list and sent with a
+// single DMA kick by GameDisplay_EndFrame, which returns while it is still
+// on its way out. A fill that no longer fits sends what is queued and
+// starts the list again, so nothing is dropped.
+void GameDisplay_BeginFrame(void);
+void GameDisplay_FrameFill(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                           uint16_t color);
+void GameDisplay_EndFrame(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ST7735_GAME_H__
@@ -0,0 +1,51 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "st7735_pio.h"
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+#include "st7735_bus.pio.h"
+
+static PIO busPio = pio0;
+static uint busSm;
+
+void ST7735_PioInit(uint pin_clk, uint pin_mosi, uint pin_dc, uint32_t baud) {
+    uint offset = pio_add_program(busPio, &st7735_bus_program);
+    busSm = pio_claim_unused_sm(busPio, true);
+    float div = (float)clock_get_hz(clk_sys) / (2.0f * baud);
+    st7735_bus_program_init(busPio, busSm, offset, pin_clk, pin_mosi, pin_dc, div < 1.0f ? 1.0f : div);
+}
+
+// Queue the header for a transfer of len bytes. The data itself follows
+// through ST7735_PioPut or a DMA channel writing ST7735_PioTxFifo.
+void ST7735_PioStart(bool dc, size_t len) {
+    if(!len)
+        return;
+    pio_sm_put_blocking(busPio, busSm, ((uint32_t)dc << 31) | (len * 8 - 1));
+}
+
+void ST7735_PioPut(const uint8_t *data, size_t len) {
+    volatile uint8_t *txf = (volatile uint8_t*)&busPio->txf[busSm];
+    while(len--) {
+        while(pio_sm_is_tx_fifo_full(busPio, busSm))
+            tight_loop_contents();
+        *txf = *data++;
+    }
+}
+
+// Wait until every queued bit has been clocked out and the SM is back at
+// the header pull, so CS can be released.
+void ST7735_PioWaitIdle(void) {
+    uint32_t stall = 1u << (PIO_FDEBUG_TXSTALL_LSB + busSm);
+    while(!pio_sm_is_tx_fifo_empty(busPio, busSm))
+        tight_loop_contents();
+    busPio->fdebug = stall;
+    while(!(busPio->fdebug & stall))
+        tight_loop_contents();
+}
+
+volatile void* ST7735_PioTxFifo(void) {
+    return &busPio->txf[busSm];
+}
+
+uint ST7735_PioDreq(void) {
+    return pio_get_dreq(busPio, busSm, true);
+}
@@ -0,0 +1,25 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __ST7735_PIO_H__
+#define __ST7735_PIO_H__
+
+#include "pico/stdlib.h"
+
+// PIO backend for the display bus, used when ST7735_USE_PIO is set. See
+// st7735_bus.pio for the FIFO format.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void ST7735_PioInit(uint pin_clk, uint pin_mosi, uint pin_dc, uint32_t baud);
+void ST7735_PioStart(bool dc, size_t len);
+void ST7735_PioPut(const uint8_t *data, size_t len);
+void ST7735_PioWaitIdle(void);
+volatile void* ST7735_PioTxFifo(void);
+uint ST7735_PioDreq(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ST7735_PIO_H__
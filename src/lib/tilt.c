@@ -0,0 +1,49 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "tilt.h"
+
+void Tilt_FilterReset(Tilt_Filter *filter, int32_t mg) {
+    filter->value = mg << 8;
+    filter->rate = 0;
+}
+
+int32_t Tilt_FilterStep(Tilt_Filter *filter, int32_t mg) {
+    const int32_t predicted = filter->value + filter->rate;
+    const int32_t error = (mg << 8) - predicted;
+    filter->value = predicted + ((error * TILT_ALPHA) >> 8);
+    filter->rate += (error * TILT_BETA) >> 8;
+    return filter->value >> 8;
+}
+
+void Tilt_FusionReset(Tilt_Fusion *fusion, int32_t mg) {
+    fusion->value = mg << 8;
+}
+
+int32_t Tilt_GyroRate(const int32_t accel[3], const int32_t gyro[3]) {
+    // Gravity is fixed in the world, so in the board's frame it turns
+    // against the rotation: dg/dt = g x w. Its x part:
+    const int32_t cross = accel[1] * gyro[2] - accel[2] * gyro[1];
+    return cross / 1000;
+}
+
+int32_t Tilt_FusionStep(Tilt_Fusion *fusion, int32_t mg, int32_t rate, uint32_t dt_us) {
+    if(dt_us > TILT_MAX_GAP_US) {
+        Tilt_FusionReset(fusion, mg);
+        return mg;
+    }
+
+    fusion->value += (int32_t)((int64_t)rate * dt_us * 256 / 1000000);
+    fusion->value += (((mg << 8) - fusion->value) * TILT_BLEND) >> 8;
+    return fusion->value >> 8;
+}
+
+int32_t Tilt_Speed(int32_t mg) {
+    const int32_t magnitude = mg < 0 ? -mg : mg;
+    if(magnitude <= TILT_DEAD_ZONE_MG)
+        return 0;
+
+    int32_t speed = TILT_MAX_SPEED_Q8;
+    if(magnitude < TILT_FULL_MG)
+        speed = (magnitude - TILT_DEAD_ZONE_MG) * TILT_MAX_SPEED_Q8
+              / (TILT_FULL_MG - TILT_DEAD_ZONE_MG);
+    return mg < 0 ? -speed : speed;
+}
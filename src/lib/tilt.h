@@ -0,0 +1,72 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __TILT_H__
+#define __TILT_H__
+
+#include <stdint.h>
+
+// Tilt input for the paddle. Accelerometer samples (in mg) go through an
+// alpha-beta filter: each step predicts the reading from the last estimate
+// and its rate, then corrects both by a fraction of the error. Unlike a
+// plain low-pass it tracks a steady tilt change with no lag, while single
+// noisy samples only move the estimate by alpha of their error. A step is
+// a fixed handful of adds, multiplies and shifts in 32-bit integers, with
+// no branches on the data, so its cost does not depend on the input.
+//
+// With the gyro, a complementary filter does better: the tilt is carried
+// forward by the gyro's rotation rate every sample, which responds at once
+// and hardly sees hand jolts, and pulled a small fraction of the way back
+// to the accelerometer so gyro bias cannot make it drift. The rotation is
+// turned into a rate of change of the x reading by crossing it with the
+// measured gravity, so no axis has to be picked for how the board is held.
+//
+// The filtered tilt is then mapped to a paddle speed: nothing inside the
+// dead zone, rising linearly to the top speed at full tilt.
+// tools/tilt_sim.py replays recorded samples through the same arithmetic.
+
+// Gains in 1/256ths
+#define TILT_ALPHA 128
+#define TILT_BETA 32
+
+// Fraction of the way the fused tilt moves to the accelerometer each
+// sample, in 1/256ths. At the 250 Hz the game reads the IMU, 8 gives a time
+// constant of about 130 ms.
+#define TILT_BLEND 8
+// Longest gap between samples the gyro is integrated over; longer ones
+// (after a pause) start from the accelerometer again
+#define TILT_MAX_GAP_US 50000
+
+#define TILT_DEAD_ZONE_MG 50
+#define TILT_FULL_MG 600
+// Paddle speed at full tilt in pixels per tick, scaled by 256
+#define TILT_MAX_SPEED_Q8 (6 << 8)
+
+typedef struct {
+    int32_t value;      // mg, scaled by 256
+    int32_t rate;       // mg per sample, scaled by 256
+} Tilt_Filter;
+
+typedef struct {
+    int32_t value;      // mg, scaled by 256
+} Tilt_Fusion;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void Tilt_FilterReset(Tilt_Filter *filter, int32_t mg);
+// Add a sample, returning the filtered tilt in mg
+int32_t Tilt_FilterStep(Tilt_Filter *filter, int32_t mg);
+void Tilt_FusionReset(Tilt_Fusion *fusion, int32_t mg);
+// Rate of change of the x reading, in mg per second, from the accelerometer
+// (mg) and gyro (mrad/s)
+int32_t Tilt_GyroRate(const int32_t accel[3], const int32_t gyro[3]);
+// Add a sample taken dt_us after the last one, returning the tilt in mg
+int32_t Tilt_FusionStep(Tilt_Fusion *fusion, int32_t mg, int32_t rate, uint32_t dt_us);
+// Paddle speed for a tilt, in pixels per tick scaled by 256
+int32_t Tilt_Speed(int32_t mg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __TILT_H__
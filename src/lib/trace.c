@@ -0,0 +1,102 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "trace.h"
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+
+#if TRACE_ENABLED
+
+_Static_assert((TRACE_BUFFER_LEN & (TRACE_BUFFER_LEN - 1)) == 0, "TRACE_BUFFER_LEN must be a power of two");
+
+static const char *const eventNames[TRACE_EV_COUNT] = {
+    [TRACE_EV_INIT_DISPLAY] = "init_display",
+    [TRACE_EV_INIT_IMU] = "init_imu",
+    [TRACE_EV_FILL_RECT] = "fill_rect",
+    [TRACE_EV_I2C_READ] = "i2c_read",
+    [TRACE_EV_I2C_WRITE] = "i2c_write",
+    [TRACE_EV_TASK_BALL] = "ball",
+    [TRACE_EV_TASK_USER_PADDLE] = "user_paddle",
+    [TRACE_EV_TASK_AI_PADDLE] = "ai_paddle",
+    [TRACE_EV_TASK_REPAINT] = "repaint",
+    [TRACE_EV_TASK_IMU] = "imu",
+};
+
+// Records per core; head counts every record ever written, so the ring
+// wrapped once head passes TRACE_BUFFER_LEN.
+static Trace_Record rings[2][TRACE_BUFFER_LEN];
+static uint32_t heads[2];
+static volatile bool paused;
+
+void Trace_Emit(uint8_t event, uint8_t phase) {
+    if(paused)
+        return;
+
+    uint core = get_core_num();
+    uint32_t irq = save_and_disable_interrupts();
+    Trace_Record *r = &rings[core][heads[core]++ & (TRACE_BUFFER_LEN - 1)];
+    r->timestamp = time_us_32();
+    r->core = core;
+    r->event = event;
+    r->phase = phase;
+    restore_interrupts(irq);
+}
+
+void Trace_EndScope(const uint8_t *event) {
+    Trace_Emit(*event, TRACE_PHASE_END);
+}
+
+// Dump format, one item per line:
+//   trace name <id> <name>
+//   trace core <core> <records>
+//   trace rec <hex bytes of up to 8 records, in memory order>
+//   trace end
+void Trace_Dump(void) {
+    paused = true;
+
+    for(uint8_t i = 0; i < TRACE_EV_COUNT; i++)
+        printf("trace name %u %s\n", i, eventNames[i]);
+
+    for(uint8_t core = 0; core < 2; core++) {
+        uint32_t head = heads[core];
+        uint32_t count = head < TRACE_BUFFER_LEN ? head : TRACE_BUFFER_LEN;
+        printf("trace core %u %lu\n", core, (unsigned long)count);
+
+        for(uint32_t i = 0; i < count; i++) {
+            const uint8_t *bytes = (const uint8_t *)&rings[core][(head - count + i) & (TRACE_BUFFER_LEN - 1)];
+            if(i % 8 == 0)
+                printf("trace rec ");
+            for(uint8_t b = 0; b < sizeof(Trace_Record); b++)
+                printf("%02x", bytes[b]);
+            if(i % 8 == 7 || i == count - 1)
+                printf("\n");
+        }
+    }
+    printf("trace end\n");
+
+    paused = false;
+}
+
+void Trace_Clear(void) {
+    uint32_t irq = save_and_disable_interrupts();
+    heads[0] = 0;
+    heads[1] = 0;
+    restore_interrupts(irq);
+}
+
+#else
+
+void Trace_Emit(uint8_t event, uint8_t phase) {
+}
+
+void Trace_EndScope(const uint8_t *event) {
+}
+
+void Trace_Dump(void) {
+    printf("trace disabled\n");
+}
+
+void Trace_Clear(void) {
+}
+
+#endif
@@ -0,0 +1,81 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Event tracing into a RAM ring buffer. Each record is 8 bytes:
+// { timestamp (us, 32-bit), core, event id, begin/end }. Every core owns its
+// own ring, so recording is a timer read, a masked store and an increment
+// with interrupts held off. Trace_Dump() writes the rings as hex over stdio
+// for tools/trace_to_chrome.py, which turns them into Chrome trace_event
+// JSON (chrome://tracing, Perfetto). With TRACE_ENABLED 0 the macros expand
+// to nothing.
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 0
+#endif
+
+// Records per core, a power of two
+#ifndef TRACE_BUFFER_LEN
+#define TRACE_BUFFER_LEN 1024
+#endif
+
+typedef enum {
+    TRACE_EV_INIT_DISPLAY,
+    TRACE_EV_INIT_IMU,
+    TRACE_EV_FILL_RECT,
+    TRACE_EV_I2C_READ,
+    TRACE_EV_I2C_WRITE,
+    TRACE_EV_TASK_BALL,
+    TRACE_EV_TASK_USER_PADDLE,
+    TRACE_EV_TASK_AI_PADDLE,
+    TRACE_EV_TASK_REPAINT,
+    TRACE_EV_TASK_IMU,
+    TRACE_EV_COUNT
+} Trace_Event;
+
+#define TRACE_PHASE_BEGIN 0
+#define TRACE_PHASE_END   1
+
+typedef struct {
+    uint32_t timestamp;
+    uint8_t core;
+    uint8_t event;
+    uint8_t phase;
+    uint8_t reserved;
+} Trace_Record;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void Trace_Emit(uint8_t event, uint8_t phase);
+// Write both rings, oldest record first. Recording pauses meanwhile.
+void Trace_Dump(void);
+void Trace_Clear(void);
+
+// Scope end hook for TRACE_SCOPE, not called directly
+void Trace_EndScope(const uint8_t *event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#if TRACE_ENABLED
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_BEGIN(ev) Trace_Emit((ev), TRACE_PHASE_BEGIN)
+#define TRACE_END(ev)   Trace_Emit((ev), TRACE_PHASE_END)
+// Begin now and end when the enclosing block is left, on any path
+#define TRACE_SCOPE(ev) \
+    const uint8_t TRACE_CONCAT(trace_scope_, __LINE__) \
+        __attribute__((cleanup(Trace_EndScope))) = (TRACE_BEGIN(ev), (ev))
+#else
+#define TRACE_BEGIN(ev) ((void)0)
+#define TRACE_END(ev)   ((void)0)
+#define TRACE_SCOPE(ev) ((void)0)
+#endif
+
+#endif // __TRACE_H__
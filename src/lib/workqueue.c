@@ -0,0 +1,183 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "workqueue.h"
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+static WQ_Task *tasks[WQ_MAX_TASKS];
+static uint8_t taskCount;
+static volatile uint64_t idleTime;
+// Read by the watchdog timer on the same core; a 32-bit load is atomic
+static volatile uint32_t completed;
+
+static void WQ_ClearStats(WQ_Task *task) {
+    task->runs = 0;
+    task->misses = 0;
+    task->coalesced = 0;
+    task->worst_latency_us = 0;
+    task->last_start = 0;
+    memset(task->jitter_hist, 0, sizeof(task->jitter_hist));
+    memset(task->exec_hist, 0, sizeof(task->exec_hist));
+}
+
+static inline uint8_t WQ_Bucket(uint32_t us) {
+    uint8_t bucket = us ? 32 - __builtin_clz(us) : 0;
+    return bucket < WQ_HIST_BUCKETS ? bucket : WQ_HIST_BUCKETS - 1;
+}
+
+bool WQ_Register(WQ_Task *task) {
+    if(taskCount >= WQ_MAX_TASKS)
+        return false;
+
+    WQ_ClearStats(task);
+    task->pending = false;
+    tasks[taskCount++] = task;
+    return true;
+}
+
+static bool WQ_TimerCallback(struct repeating_timer *t) {
+    WQ_Post((WQ_Task *)t->user_data);
+    return true;
+}
+
+bool WQ_AddPeriodic(WQ_Task *task, uint32_t period_ms) {
+    if(!WQ_Register(task))
+        return false;
+
+    return WQ_StartPeriodic(task, period_ms);
+}
+
+bool WQ_StartPeriodic(WQ_Task *task, uint32_t period_ms) {
+    if(task->deadline_us == 0)
+        task->deadline_us = period_ms * 1000;
+    task->period_us = period_ms * 1000;
+    // A restart is not late for its first run
+    task->last_start = 0;
+
+    // Negative delay: period measured between callback starts
+    return add_repeating_timer_ms(-(int32_t)period_ms, WQ_TimerCallback, task, &task->timer);
+}
+
+void WQ_CancelPeriodic(WQ_Task *task) {
+    cancel_repeating_timer(&task->timer);
+    task->pending = false;
+}
+
+void WQ_Post(WQ_Task *task) {
+    uint32_t irq = save_and_disable_interrupts();
+    if(task->pending) {
+        task->coalesced++;
+    } else {
+        task->posted_at = time_us_64();
+        task->pending = true;
+    }
+    restore_interrupts(irq);
+}
+
+bool WQ_RunOnce(void) {
+    WQ_Task *next = NULL;
+    uint64_t posted_at = 0;
+
+    uint32_t irq = save_and_disable_interrupts();
+    for(uint8_t i = 0; i < taskCount; i++) {
+        WQ_Task *task = tasks[i];
+        if(task->pending && (!next || task->priority < next->priority))
+            next = task;
+    }
+    if(next) {
+        next->pending = false;
+        posted_at = next->posted_at;
+    }
+    restore_interrupts(irq);
+
+    if(!next)
+        return false;
+
+    uint64_t start = time_us_64();
+    uint32_t latency = start - posted_at;
+    if(latency > next->worst_latency_us)
+        next->worst_latency_us = latency;
+    if(latency > next->deadline_us)
+        next->misses++;
+    if(next->period_us && next->last_start) {
+        int32_t jitter = (int32_t)(start - next->last_start) - (int32_t)next->period_us;
+        next->jitter_hist[WQ_Bucket(jitter < 0 ? -jitter : jitter)]++;
+    }
+    next->last_start = start;
+
+    next->handler(next->user_data);
+
+    next->exec_hist[WQ_Bucket(time_us_64() - start)]++;
+    next->runs++;
+    completed++;
+    return true;
+}
+
+static bool WQ_AnyPending(void) {
+    for(uint8_t i = 0; i < taskCount; i++) {
+        if(tasks[i]->pending)
+            return true;
+    }
+    return false;
+}
+
+void WQ_Run(void) {
+    while(true) {
+        if(WQ_RunOnce())
+            continue;
+
+        // Check and sleep with interrupts masked so a post cannot slip in
+        // between; a pending interrupt still ends WFI, and its handler runs
+        // once they are restored.
+        uint32_t irq = save_and_disable_interrupts();
+        if(!WQ_AnyPending()) {
+            uint64_t start = time_us_64();
+            __wfi();
+            idleTime += time_us_64() - start;
+        }
+        restore_interrupts(irq);
+    }
+}
+
+uint32_t WQ_Completed(void) {
+    return completed;
+}
+
+uint64_t WQ_IdleTimeUs(void) {
+    uint32_t irq = save_and_disable_interrupts();
+    uint64_t idle = idleTime;
+    restore_interrupts(irq);
+    return idle;
+}
+
+void WQ_PrintStats(void) {
+    for(uint8_t i = 0; i < taskCount; i++) {
+        const WQ_Task *task = tasks[i];
+        printf("%-10s prio %d runs %lu missed %lu coalesced %lu worst %lu us\n",
+               task->name, task->priority,
+               (unsigned long)task->runs, (unsigned long)task->misses,
+               (unsigned long)task->coalesced, (unsigned long)task->worst_latency_us);
+    }
+}
+
+static void WQ_PrintHistogram(const char *name, const char *kind, const uint32_t *hist) {
+    printf("hist %s %s", name, kind);
+    for(uint8_t i = 0; i < WQ_HIST_BUCKETS; i++)
+        printf(" %lu", (unsigned long)hist[i]);
+    printf("\n");
+}
+
+// One line per task and kind: "hist <task> <jitter|exec> <bucket counts...>"
+void WQ_PrintHistograms(void) {
+    for(uint8_t i = 0; i < taskCount; i++) {
+        WQ_PrintHistogram(tasks[i]->name, "jitter", tasks[i]->jitter_hist);
+        WQ_PrintHistogram(tasks[i]->name, "exec", tasks[i]->exec_hist);
+    }
+    printf("hist end\n");
+}
+
+void WQ_ResetStats(void) {
+    for(uint8_t i = 0; i < taskCount; i++)
+        WQ_ClearStats(tasks[i]);
+}
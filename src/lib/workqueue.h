@@ -0,0 +1,90 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __WORKQUEUE_H__
+#define __WORKQUEUE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/time.h"
+
+// Work-queue executor for the main loop. Timer callbacks only mark a task
+// pending; WQ_Run() picks the highest priority pending task and runs it in
+// thread context, so long SPI and I2C transfers never hold up other alarms.
+// A task posted again before it has run is coalesced into one run. A run
+// that starts more than deadline_us after its post counts as a miss.
+//
+// Each task also keeps log2 histograms of start jitter (how far the gap
+// between two starts strays from the period) and of execution time. Bucket
+// 0 counts 0 us and bucket n counts [2^(n-1), 2^n) us; the last bucket also
+// takes everything longer. WQ_PrintHistograms() writes them out for
+// tools/wq_histogram.py.
+//
+// With nothing pending the executor sleeps in WFI until the next interrupt
+// and adds the time slept to WQ_IdleTimeUs().
+
+#define WQ_MAX_TASKS 12
+#define WQ_HIST_BUCKETS 16
+
+typedef enum {
+    WQ_PRIORITY_HIGH,
+    WQ_PRIORITY_NORMAL,
+    WQ_PRIORITY_LOW,
+    WQ_PRIORITY_COUNT
+} WQ_Priority;
+
+typedef void (*WQ_Handler)(void *user_data);
+
+typedef struct WQ_Task {
+    const char *name;
+    WQ_Handler handler;
+    void *user_data;
+    WQ_Priority priority;
+    uint32_t deadline_us;
+
+    // Statistics, updated by the executor
+    uint32_t runs;
+    uint32_t misses;
+    uint32_t coalesced;
+    uint32_t worst_latency_us;
+    uint32_t jitter_hist[WQ_HIST_BUCKETS];
+    uint32_t exec_hist[WQ_HIST_BUCKETS];
+
+    // Executor state
+    volatile bool pending;
+    volatile uint64_t posted_at;
+    uint64_t last_start;
+    uint32_t period_us;
+    struct repeating_timer timer;
+} WQ_Task;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Register a task. Returns false if the task table is full.
+bool WQ_Register(WQ_Task *task);
+// Register a task and post it every period_ms from an alarm. A zero
+// deadline_us defaults to the period.
+bool WQ_AddPeriodic(WQ_Task *task, uint32_t period_ms);
+// Stop or restart the alarm of a task added with WQ_AddPeriodic
+void WQ_CancelPeriodic(WQ_Task *task);
+bool WQ_StartPeriodic(WQ_Task *task, uint32_t period_ms);
+// Mark a task pending. Safe to call from interrupt handlers.
+void WQ_Post(WQ_Task *task);
+// Run the highest priority pending task. Returns false if none was pending.
+bool WQ_RunOnce(void);
+// Run pending tasks forever
+void WQ_Run(void);
+// Total time the executor has spent asleep waiting for work
+uint64_t WQ_IdleTimeUs(void);
+// Runs the executor has finished since boot, never reset; a watchdog that
+// sees it stop moving knows the main loop is stuck in a task.
+uint32_t WQ_Completed(void);
+void WQ_PrintStats(void);
+void WQ_PrintHistograms(void);
+void WQ_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __WORKQUEUE_H__
@@ -4,18 +4,52 @@
 #include "pico/time.h"
 #include "lib/fonts.h"
 #include "lib/st7735.h"
+#include "lib/st7735_game.h"
 #include "lib/ICM20948.h"
+#include "lib/workqueue.h"
+#include "lib/trace.h"
+#include "lib/dlog.h"
+#include "lib/latency.h"
+#include "lib/boot.h"
+#include "lib/backlight.h"
+#include "lib/st7735_fx.h"
+#include "lib/framebuffer.h"
+#include "lib/tilt.h"
+#include "lib/ai.h"
+#include "lib/DEV_Config.h"
+#include "arducam_logo_rle.h"
 #include "pico/multicore.h"
+#include "hardware/clocks.h"
 #include "hardware/watchdog.h"
 
 void paintGameOverText();
 void startGame();
+void imuBoot();
+void paintSplash();
 void restartGame();
-bool repaintTask();
-bool ballTask();
-bool userPaddleTask();
-bool aiPaddleTask();
-bool accelerometerTask();
+void resetGameState();
+void repaintTask(void *);
+void ballTask(void *);
+void imuTask(void *);
+void userPaddleTask(void *);
+void aiPaddleTask(void *);
+int predictInterceptY();
+uint32_t aiRandom();
+void aiPlan();
+void consoleTask(void *);
+void reportText();
+void reportRotations();
+void reportDisplayBus();
+void logTask(void *);
+void powerTask(void *);
+void wakeTask(void *);
+void setSystemClock(uint32_t khz);
+void noteInput();
+void enterPause();
+uint32_t imuPeriodMillis();
+void setImuPreset(const ICM20948_ST_CONFIG *preset, bool poll);
+bool applyImuPreset();
+void leavePause();
 bool monitoringTask();
 void paintBall();
 void paintAiPaddle();
@@ -24,9 +58,37 @@ void paintDivider();
 
 #define PADDLE_WIDTH 10
 #define PADDLE_HEIGHT 30
-#define MAX_PADDLE_Y (ST7735_WIDTH - PADDLE_HEIGHT)
+#define MAX_PADDLE_Y (GAME_HEIGHT - PADDLE_HEIGHT)
 #define BALL_SIZE 5
+// Pixels the ball moves on each axis per tick
+#define BALL_STEP 1
+#define TICK_MILLIS 16
+#define LOG_MILLIS 20
 #define WATCHDOG_MILLIS 100
+// The executor finishes a run at least every LOG_MILLIS, paused or not, and
+// the main loop counts as hung once it has missed a few. The longest run
+// allowed on top is leavePause waiting out the panel's wake. The monitor
+// kicks every WATCHDOG_MILLIS - 10, so a hang resets within HANG_MILLIS +
+// WATCHDOG_MILLIS.
+#define HANG_MILLIS (3 * LOG_MILLIS + ST7735_WAKE_MILLIS)
+_Static_assert(TICK_MILLIS <= LOG_MILLIS && HANG_MILLIS < 2 * WATCHDOG_MILLIS,
+               "a stuck main loop must reset within two watchdog periods");
+// With no good IMU read for this long the paddle stops
+#define IMU_STALE_MILLIS 100
+#define I2C_BAUD (400 * 1000)
+
+// Power saving: with no paddle input for ATTRACT_MILLIS the game pauses, the
+// display and IMU sleep and the accelerometer is polled every
+// WAKE_POLL_MILLIS for a tilt to resume. While paused the system clock can
+// also be dropped; SPI and I2C dividers are reprogrammed on every change.
+// After DIM_MILLIS the backlight dims, on boards built with DEV_BL_PIN.
+#define ATTRACT_MILLIS 30000
+#define DIM_MILLIS 10000
+#define DIM_PERCENT 20
+#define WAKE_POLL_MILLIS 250
+#define SCALE_CLOCK_WHEN_PAUSED 1
+#define RUN_CLOCK_KHZ 125000
+#define PAUSE_CLOCK_KHZ 48000
 
 // Components should only be repainted if they have changed in some way.
 // These flags track this.
@@ -42,84 +104,222 @@ volatile uint16_t prevBallX = 80;
 volatile uint16_t prevBallY = 35;
 volatile int ballMagnitudeX = 1;
 volatile int ballMagnitudeY = 1;
-volatile bool shouldCleanReset = false;
+
+// Paddle position scaled by 256, so slow speeds still add up
+int32_t userPaddleQ8 = 0;
+
+// Tilt in mg from the IMU task, with when its sample was read, and the
+// filters behind it: gyro fusion, or the accelerometer alone
+volatile int32_t tiltMg = 0;
+volatile uint32_t tiltReadStart = 0;
+volatile uint32_t tiltAcquired = 0;
+Tilt_Filter tiltFilter;
+Tilt_Fusion tiltFusion;
+uint32_t lastImuSample = 0;
+bool tiltPrimed = false;
+bool useGyro = true;
+// Log every raw sample for tools/tilt_sim.py
+bool recordTilt = false;
+// A preset a bus failure kept from reaching the IMU, tried again on each read
+const ICM20948_ST_CONFIG *imuPresetPending = NULL;
+
+// AI skill: how long after the ball turns towards or away from it the AI
+// reacts, how far its aim may be off, and how fast the paddle can move, in
+// pixels per AI tick scaled by 256 so slow skills can creep.
+typedef struct
+{
+  uint16_t reactionMillis;
+  uint8_t errorPixels;
+  int32_t maxSpeedQ8;
+} AiSkill;
+
+const AiSkill AI_EASY = {.reactionMillis = 300, .errorPixels = 10, .maxSpeedQ8 = 320};
+const AiSkill AI_NORMAL = {.reactionMillis = 150, .errorPixels = 5, .maxSpeedQ8 = 512};
+const AiSkill AI_HARD = {.reactionMillis = 50, .errorPixels = 1, .maxSpeedQ8 = 768};
+const AiSkill *aiSkill = &AI_NORMAL;
+
+// AI state: position and target scaled by 256, the ball direction last
+// planned for and when the pending plan is due.
+int32_t aiPaddleQ8 = 35 << 8;
+int32_t aiTargetQ8 = 35 << 8;
+int aiSeenDirection = 0;
+bool aiPlanPending = false;
+uint32_t aiPlanAt = 0;
+uint32_t aiRandomState = 0x2545f491;
+
+// The watchdog is only kicked while the executor keeps finishing runs
+volatile bool gameStarted = false;
+
+bool paused = false;
+bool dimmed = false;
+uint32_t lastInputMillis = 0;
+bool reportLoad = false;
 
 // Timers
 struct repeating_timer monitoringTimer;
-struct repeating_timer repaintTimer;
-struct repeating_timer ballTimer;
-struct repeating_timer userPaddleTimer;
-struct repeating_timer aiPaddleTimer;
+
+// Work items, run from the main loop. Game logic outranks the I2C read,
+// which outranks painting.
+WQ_Task ballWork = {.name = "ball", .handler = ballTask, .priority = WQ_PRIORITY_HIGH};
+WQ_Task imuWork = {.name = "imu", .handler = imuTask, .priority = WQ_PRIORITY_NORMAL};
+WQ_Task userPaddleWork = {.name = "userPaddle", .handler = userPaddleTask, .priority = WQ_PRIORITY_NORMAL};
+WQ_Task aiPaddleWork = {.name = "aiPaddle", .handler = aiPaddleTask, .priority = WQ_PRIORITY_NORMAL};
+WQ_Task repaintWork = {.name = "repaint", .handler = repaintTask, .priority = WQ_PRIORITY_LOW};
+WQ_Task consoleWork = {.name = "console", .handler = consoleTask, .priority = WQ_PRIORITY_LOW};
+WQ_Task logWork = {.name = "log", .handler = logTask, .priority = WQ_PRIORITY_LOW};
+WQ_Task powerWork = {.name = "power", .handler = powerTask, .priority = WQ_PRIORITY_LOW};
+WQ_Task wakeWork = {.name = "wake", .handler = wakeTask, .priority = WQ_PRIORITY_NORMAL};
 
 int main()
 {
   // INITIALISE SERIAL IN/OUTPUT
   stdio_init_all();
+  // Disable line and block buffering on stdout (for talking through serial)
+  setvbuf(stdout, NULL, _IONBF, 0);
 
   // ENABLE WATCHDOG
   watchdog_enable(WATCHDOG_MILLIS, true);
   add_repeating_timer_ms(WATCHDOG_MILLIS - 10, monitoringTask, NULL, &monitoringTimer);
 
-  // INITIALISE SCREEN (https://github.com/plaaosert/st7735-guide)
-  // ---------------------------------------------------------------------------
-  // Disable line and block buffering on stdout (for talking through serial)
-  setvbuf(stdout, NULL, _IONBF, 0);
-  // Give the Pico some time to think...
-  sleep_ms(1000);
-  // Initialise the screen
-  ST7735_Init();
-  ST7735_FillScreen(ST7735_BLACK);
+  // The IMU and the screen share nothing, so the IMU is brought up on core 1
+  // while core 0 sits in the display's init delays.
+  multicore_launch_core1(imuBoot);
 
-  // INITIALISE ACCELEROMETER (https://github.com/plaaosert/icm20948-guide)
+  // INITIALISE SCREEN (https://github.com/plaaosert/st7735-guide)
   // ---------------------------------------------------------------------------
-  i2c_init(i2c0, 400 * 1000);
-  gpio_set_function(4, GPIO_FUNC_I2C);
-  gpio_set_function(5, GPIO_FUNC_I2C);
-  gpio_pull_up(4);
-  gpio_pull_up(5);
-  IMU_EN_SENSOR_TYPE enMotionSensorType;
-  imuInit(&enMotionSensorType);
+  uint8_t phase = Boot_PhaseBegin("display init");
+  TRACE_BEGIN(TRACE_EV_INIT_DISPLAY);
+  GameDisplay_Init();
+  TRACE_END(TRACE_EV_INIT_DISPLAY);
+  Boot_PhaseEnd(phase);
+
+  phase = Boot_PhaseBegin("splash");
+  paintSplash();
+  ST7735_WaitIdle();
+  Backlight_FadeTo(100, 300);
+  Boot_PhaseEnd(phase);
+
+  phase = Boot_PhaseBegin("wait for imu");
+  IMU_EN_SENSOR_TYPE enMotionSensorType = multicore_fifo_pop_blocking();
+  Boot_PhaseEnd(phase);
   if (IMU_EN_SENSOR_TYPE_ICM20948 != enMotionSensorType)
   {
     printf("Failed to initialise IMU...\n");
   }
-  printf("IMU initialised!\n");
+  printf("IMU initialised! Read every %lu ms, samples are ~%lu us old when read\n",
+         (unsigned long)imuPeriodMillis(), (unsigned long)icm20948SampleDelayUs());
+  Boot_PrintTimeline();
 
   startGame();
 }
 
+// INITIALISE ACCELEROMETER (https://github.com/plaaosert/icm20948-guide)
+// -----------------------------------------------------------------------------
+// Runs on core 1 and hands the detected sensor type to core 0 through the
+// FIFO, then parks the core.
+void imuBoot()
+{
+  uint8_t phase = Boot_PhaseBegin("imu init");
+  TRACE_BEGIN(TRACE_EV_INIT_IMU);
+  icm20948BusInit(I2C_BAUD);
+  IMU_EN_SENSOR_TYPE enMotionSensorType;
+  imuInit(&enMotionSensorType);
+  TRACE_END(TRACE_EV_INIT_IMU);
+  Boot_PhaseEnd(phase);
+
+  multicore_fifo_push_blocking(enMotionSensorType);
+  while (true)
+    __wfe();
+}
+
+// Shown as soon as the panel is awake, until the IMU is ready.
+void paintSplash()
+{
+  GameDisplay_DrawPanelImage(arducam_logo_rle, ARDUCAM_LOGO_RLE_WIDTH, ARDUCAM_LOGO_RLE_HEIGHT);
+}
+
 void startGame()
 {
   printf("Starting game\n");
+  GameDisplay_FillScreen(ST7735_BLACK);
+  gameStarted = true;
 
-  // Timers
+  // Timers only post work; everything runs here on the main loop
   // ---------------------------------------------------------------------------
-  const int32_t tick = -16;
-  add_repeating_timer_ms(tick, repaintTask, NULL, &repaintTimer);
-  add_repeating_timer_ms(tick, ballTask, NULL, &ballTimer);
-  add_repeating_timer_ms(tick, userPaddleTask, NULL, &userPaddleTimer);
-  add_repeating_timer_ms(tick * 3, aiPaddleTask, NULL, &aiPaddleTimer);
+  lastInputMillis = to_ms_since_boot(get_absolute_time());
+  // Boot time varies enough to seed the AI's aiming error
+  aiRandomState ^= time_us_32();
+  bool registered = WQ_AddPeriodic(&ballWork, TICK_MILLIS)
+                    && WQ_Register(&imuWork)
+                    && WQ_AddPeriodic(&userPaddleWork, TICK_MILLIS)
+                    && WQ_AddPeriodic(&aiPaddleWork, TICK_MILLIS * 3)
+                    && WQ_AddPeriodic(&repaintWork, TICK_MILLIS)
+                    && WQ_AddPeriodic(&consoleWork, 100)
+                    && WQ_AddPeriodic(&logWork, LOG_MILLIS)
+                    && WQ_AddPeriodic(&powerWork, 1000)
+                    // Only runs while paused
+                    && WQ_Register(&wakeWork);
+  // A task left out of the table would never run
+  if (!registered)
+    panic("work queue full, raise WQ_MAX_TASKS\n");
+  // Written again so a preset lost during the IMU's init is retried
+  setImuPreset(&gstIcm20948LowLatency, true);
+
+  WQ_Run();
+}
 
-  while (true)
-    tight_loop_contents();
+// Put every game object back at its starting position.
+void resetGameState()
+{
+  userPaddleY = 0;
+  userPaddleQ8 = 0;
+  tiltMg = 0;
+  tiltPrimed = false;
+  aiPaddleY = 35;
+  ballX = prevBallX = 80;
+  ballY = prevBallY = 35;
+  ballMagnitudeX = 1;
+  ballMagnitudeY = 1;
+  aiPaddleQ8 = aiTargetQ8 = 35 << 8;
+  aiSeenDirection = 0;
+  aiPlanPending = false;
+  userPaddleDirty = true;
+  aiPaddleDirty = true;
 }
 
-// Fill the screen red and clean reset the microcontroller.
+// Flash and shake the screen and serve again straight away. The effects are
+// done by the controller, the display and IMU stay initialised, and only the
+// ball and paddles are repainted.
 void restartGame()
 {
-  cancel_repeating_timer(&repaintTimer);
-  ST7735_FillScreen(ST7735_RED);
-  shouldCleanReset = true;
+  const uint32_t gameOver = time_us_32();
+  DLOG2("game over, ball at %u,%u\n", ballX, ballY);
+
+  ST7735_FxFlash(2, 80);
+  ST7735_FxShake(4, 300);
+  GameDisplay_FillRectangle(ballX, ballY, BALL_SIZE, BALL_SIZE, ST7735_BLACK);
+  resetGameState();
+  repaintTask(NULL);
+  ST7735_WaitIdle();
+
+  DLOG1("next serve after %u us\n", time_us_32() - gameOver);
 }
 
 // Tasks
 // -----------------------------------------------------------------------------
 
-bool repaintTask()
+void repaintTask(void *unused)
 {
+  TRACE_SCOPE(TRACE_EV_TASK_REPAINT);
+  // Effects first, so their commands do not wait behind the frame
+  ST7735_FxStep();
+
+  // Everything that changed goes out as one command list
+  GameDisplay_BeginFrame();
   if (userPaddleDirty)
   {
     userPaddleDirty = false;
+    Latency_PaintStart();
     paintUserPaddle();
   }
   if (aiPaddleDirty)
@@ -129,20 +329,26 @@ bool repaintTask()
   }
   paintDivider();
   paintBall();
-  return true;
+  GameDisplay_EndFrame();
+
+  // The paddle is on screen once the frame has drained
+  if (Latency_Enabled())
+    ST7735_WaitIdle();
+  Latency_PaintEnd();
 }
 
 // Move the ball.
-bool ballTask()
+void ballTask(void *unused)
 {
+  TRACE_SCOPE(TRACE_EV_TASK_BALL);
   // Colission detect with edges
-  if (ballY + BALL_SIZE >= ST7735_WIDTH || ballY <= 0)
+  if (ballY + BALL_SIZE >= GAME_HEIGHT || ballY <= 0)
   {
     // Ball is at top or bottom so change its direction
     ballMagnitudeY = -ballMagnitudeY;
   }
   bool onLeftEdge = ballX <= PADDLE_WIDTH;
-  bool onRightEdge = ballX + BALL_SIZE >= ST7735_HEIGHT - PADDLE_WIDTH;
+  bool onRightEdge = ballX + BALL_SIZE >= GAME_WIDTH - PADDLE_WIDTH;
   if (onLeftEdge || onRightEdge)
   {
     if (onLeftEdge)
@@ -150,13 +356,19 @@ bool ballTask()
       // Check if the ball is in range of the paddle
       bool inRange = ballY >= userPaddleY && ballY + BALL_SIZE <= userPaddleY + PADDLE_HEIGHT;
       if (!inRange)
+      {
         restartGame();
+        return;
+      }
     }
     if (onRightEdge)
     {
       bool inRange = ballY >= aiPaddleY && ballY + BALL_SIZE <= aiPaddleY + PADDLE_HEIGHT;
       if (!inRange)
+      {
         restartGame();
+        return;
+      }
     }
 
     // Ball is at left or right edge so change its direction
@@ -167,155 +379,512 @@ bool ballTask()
   prevBallX = ballX;
   prevBallY = ballY;
 
-  const uint16_t ballStep = 1;
+  ballX += BALL_STEP * ballMagnitudeX;
+  ballY += BALL_STEP * ballMagnitudeY;
+}
 
-  ballX += ballStep * ballMagnitudeX;
-  ballY += ballStep * ballMagnitudeY;
+// Where the ball's top edge will be when it reaches the AI paddle (see
+// lib/ai.h).
+int predictInterceptY()
+{
+  return Ai_InterceptY(ballX, ballY, ballMagnitudeX * BALL_STEP, ballMagnitudeY * BALL_STEP,
+                       GAME_WIDTH - PADDLE_WIDTH - BALL_SIZE, GAME_HEIGHT - BALL_SIZE);
+}
 
-  return true;
+// Small xorshift for the AI's aiming error; rand() would pull in far more.
+uint32_t aiRandom()
+{
+  aiRandomState ^= aiRandomState << 13;
+  aiRandomState ^= aiRandomState >> 17;
+  aiRandomState ^= aiRandomState << 5;
+  return aiRandomState;
 }
 
-// Compare the delta between the AI paddle and the ball then move the paddle accordingly.
-bool aiPaddleTask()
+// Pick the paddle position to head for: under the predicted intercept, off
+// by up to the skill's error, while the ball comes towards the AI; back to
+// the middle while it goes away.
+void aiPlan()
 {
-  uint16_t paddleCenterY = aiPaddleY + (PADDLE_HEIGHT / 2);
-  uint16_t ballCenterY = ballY + (BALL_SIZE / 2);
-  int delta = paddleCenterY - ballCenterY;
+  int target = MAX_PADDLE_Y / 2;
+  if (ballMagnitudeX > 0)
+  {
+    const int error = aiSkill->errorPixels;
+    target = predictInterceptY() + BALL_SIZE / 2 - PADDLE_HEIGHT / 2;
+    if (error)
+      target += (int)(aiRandom() % (2 * error + 1)) - error;
+  }
+  if (target < 0)
+    target = 0;
+  if (target > MAX_PADDLE_Y)
+    target = MAX_PADDLE_Y;
+  aiTargetQ8 = target << 8;
+}
 
-  // The number of pixels to move
-  uint16_t step = 2;
+// Move the AI paddle towards its target at the skill's top speed. The target
+// is only worked out again when the ball changes horizontal direction, once
+// the skill's reaction time has passed, so most runs are a compare and an add.
+void aiPaddleTask(void *unused)
+{
+  TRACE_SCOPE(TRACE_EV_TASK_AI_PADDLE);
+  const uint32_t now = to_ms_since_boot(get_absolute_time());
 
-  if (delta > 0 && aiPaddleY >= step)
+  if (ballMagnitudeX != aiSeenDirection)
   {
-    // Move paddle up
-    aiPaddleDirty = true;
-    aiPaddleY -= step;
+    aiSeenDirection = ballMagnitudeX;
+    aiPlanAt = now + aiSkill->reactionMillis;
+    aiPlanPending = true;
   }
-  if (delta < 0 && aiPaddleY + PADDLE_HEIGHT + step <= ST7735_WIDTH)
+  if (aiPlanPending && (int32_t)(now - aiPlanAt) >= 0)
   {
-    // Move paddle down
-    aiPaddleDirty = true;
-    aiPaddleY += step;
+    aiPlanPending = false;
+    aiPlan();
   }
 
-  return true;
+  int32_t delta = aiTargetQ8 - aiPaddleQ8;
+  if (delta > aiSkill->maxSpeedQ8)
+    delta = aiSkill->maxSpeedQ8;
+  if (delta < -aiSkill->maxSpeedQ8)
+    delta = -aiSkill->maxSpeedQ8;
+  aiPaddleQ8 += delta;
+
+  const uint16_t y = aiPaddleQ8 >> 8;
+  if (y != aiPaddleY)
+  {
+    aiPaddleY = y;
+    aiPaddleDirty = true;
+  }
 }
 
-// Use the accelerometer reading to move the user paddle.
-bool userPaddleTask()
+// Read the accelerometer and gyro at the sensor's output rate and update
+// the tilt that drives the user paddle. Both filters run on every sample so
+// the console can switch between them.
+void imuTask(void *unused)
 {
-  float x;
-  float y;
-  float z;
+  TRACE_SCOPE(TRACE_EV_TASK_IMU);
+  if (imuPresetPending && applyImuPreset())
+  {
+    // Read at the rate of the preset that has now arrived
+    WQ_CancelPeriodic(&imuWork);
+    WQ_StartPeriodic(&imuWork, imuPeriodMillis());
+  }
 
-  // Use the addresses of our variables.
-  // This function sets data at a pointer, so we give it three pointers.
-  icm20948AccelRead(&x, &y, &z);
+  ICM20948_ST_MOTION motion;
+  if (!icm20948MotionRead(&motion))
+  {
+    // Keep the last tilt through a bus glitch, but don't leave the paddle
+    // running on it if the sensor has gone for good
+    if (time_us_32() - lastImuSample > IMU_STALE_MILLIS * 1000)
+    {
+      tiltMg = 0;
+      tiltPrimed = false;
+    }
+    return;
+  }
+  const uint32_t acquired = time_us_32();
 
   // Down = +x
-  // printf("x: %.2f\n", x);
-  const float threshold = 0.3;
+  const int32_t *a = motion.s32AccelMg;
+  const int32_t rate = Tilt_GyroRate(a, motion.s32GyroMrads);
+  if (recordTilt)
+    DLOG2("tilt %d %d\n", a[0], rate);
 
-  const bool atTop = userPaddleY <= 0;
-  const bool atBottom = userPaddleY >= MAX_PADDLE_Y;
+  if (!tiltPrimed)
+  {
+    Tilt_FilterReset(&tiltFilter, a[0]);
+    Tilt_FusionReset(&tiltFusion, a[0]);
+    lastImuSample = motion.u32TimeUs;
+    tiltPrimed = true;
+  }
+  const int32_t filtered = Tilt_FilterStep(&tiltFilter, a[0]);
+  const int32_t fused = Tilt_FusionStep(&tiltFusion, a[0], rate, motion.u32TimeUs - lastImuSample);
+  lastImuSample = motion.u32TimeUs;
 
-  // The number of pixels to move if the device is tilted.
-  const uint16_t step = 2;
+  tiltMg = useGyro ? fused : filtered;
+  tiltReadStart = motion.u32TimeUs;
+  tiltAcquired = acquired;
+}
 
-  // Detect action
-  if (x > threshold && !atBottom)
+// Move the user paddle at a speed set by the tilt, so a slight tilt nudges
+// it and a steep one sends it across the screen.
+void userPaddleTask(void *unused)
+{
+  TRACE_SCOPE(TRACE_EV_TASK_USER_PADDLE);
+  userPaddleQ8 += Tilt_Speed(tiltMg);
+  if (userPaddleQ8 < 0)
+    userPaddleQ8 = 0;
+  if (userPaddleQ8 > MAX_PADDLE_Y << 8)
+    userPaddleQ8 = MAX_PADDLE_Y << 8;
+
+  const uint16_t paddleY = userPaddleQ8 >> 8;
+  if (paddleY != userPaddleY)
   {
-    // Move down
     userPaddleDirty = true;
-    userPaddleY += step;
+    userPaddleY = paddleY;
+    noteInput();
+    Latency_Input(tiltReadStart, tiltAcquired);
+  }
+}
+
+// Answer single-character requests on the USB serial port:
+// 'h' dumps the task histograms (see tools/wq_histogram.py), 's' prints the
+// task counters, 't' dumps the trace rings (see tools/trace_to_chrome.py),
+// 'l' measures the cost of a deferred log call, 'b' repeats the boot
+// timeline, 'p' starts or stops the input-to-photon latency measurement
+// (reporting when it stops), 'u' toggles the per-second busy/idle report,
+// 'a' toggles logging of raw tilt samples (see tools/tilt_sim.py), 'g'
+// switches the paddle between gyro fusion and the accelerometer alone, 'i'
+// prints the I2C error counters, 'f' stalls the next 20 I2C transfers (in
+// builds with ICM20948_FAULT_INJECTION), 'o' times screen and paddle fills
+// in each panel rotation, 'e' measures the framebuffer's bytes and
+// expansion cycles, 'd' times a screen of pixels on the display bus, 'c'
+// draws the score digits and prints the glyph cache hits and misses and
+// characters per second, '1' to '3' set the AI to easy, normal or hard,
+// space pauses or resumes and 'r' clears the counters.
+void consoleTask(void *unused)
+{
+  int c = getchar_timeout_us(0);
+  if (c == 'h')
+    WQ_PrintHistograms();
+  else if (c == 's')
+    WQ_PrintStats();
+  else if (c == 't')
+    Trace_Dump();
+  else if (c == 'l')
+    DLog_MeasureCost(32);
+  else if (c == 'b')
+    Boot_PrintTimeline();
+  else if (c == 'u')
+    reportLoad = !reportLoad;
+  else if (c == 'a')
+    recordTilt = !recordTilt;
+  else if (c == 'g')
+    useGyro = !useGyro;
+  else if (c == 'i')
+  {
+    const ICM20948_ST_BUS_STATS *bus = icm20948BusStats();
+    printf("i2c: %lu timeouts, %lu errors, %lu recoveries, %lu skipped\n",
+           (unsigned long)bus->u32Timeouts, (unsigned long)bus->u32Errors,
+           (unsigned long)bus->u32Recoveries, (unsigned long)bus->u32Skipped);
   }
-  else if (x < -threshold && !atTop)
+  else if (c == 'f')
+    icm20948InjectStalls(20);
+  else if (c == 'e')
+    FB_MeasureCost();
+  else if (c == 'c')
+    reportText();
+  else if (c == 'd')
+    reportDisplayBus();
+  else if (c == 'o')
   {
-    // Move up
-    userPaddleDirty = true;
-    userPaddleY -= step;
+    reportRotations();
   }
+  else if (c == '1')
+    aiSkill = &AI_EASY;
+  else if (c == '2')
+    aiSkill = &AI_NORMAL;
+  else if (c == '3')
+    aiSkill = &AI_HARD;
+  else if (c == ' ')
+  {
+    if (paused)
+      leavePause();
+    else
+      enterPause();
+  }
+  else if (c == 'p')
+  {
+    if (Latency_Enabled())
+      Latency_Report();
+    Latency_Enable(!Latency_Enabled());
+  }
+  else if (c == 'r')
+  {
+    WQ_ResetStats();
+    Trace_Clear();
+    ST7735_ResetTextStats();
+  }
+}
+
+// Draw a line of digits over the top of the court, so the glyph cache has
+// something to hit, then print the text counters since they were last
+// cleared. The game draws no text of its own. Eight digits fill the cache
+// without evicting each other and fit on one line, so after the first pass
+// every glyph is a hit and the whole line goes out as one window.
+void reportText()
+{
+  // The panel stays in its native portrait rotation, which fits four digits
+  static const char digits[] = "0123";
+  _Static_assert(sizeof(digits) - 1 <= ST7735_GLYPH_CACHE_SIZE, "digits must fit the glyph cache");
+  _Static_assert((sizeof(digits) - 1) * 16 <= ST7735_WIDTH, "digits must fit on one line");
+  for (int i = 0; i < 20; i++)
+    ST7735_WriteString(0, 0, digits, Font_16x26, ST7735_WHITE, ST7735_BLACK);
+  ST7735_FillRectangle(0, 0, ST7735_WIDTH, Font_16x26.height, ST7735_BLACK);
+  userPaddleDirty = true;
+  aiPaddleDirty = true;
+
+  ST7735_TextStats text;
+  ST7735_GetTextStats(&text);
+  const uint32_t lookups = text.hits + text.misses;
+  printf("text: %lu hits, %lu misses (%lu%%), %lu chars/s\n",
+         (unsigned long)text.hits, (unsigned long)text.misses,
+         (unsigned long)(lookups ? text.hits * 100ull / lookups : 0),
+         (unsigned long)(text.us ? text.chars * 1000000ull / text.us : 0));
+}
+
+// Fill throughput in each panel rotation, to see whether turning the panel
+// in MADCTL costs anything over the native scan the game draws in.
+void reportRotations()
+{
+  static const char *names[] = {"portrait", "landscape", "portrait 180", "landscape 180"};
+  const uint32_t screenBytes = ST7735_WIDTH * ST7735_HEIGHT * 2;
+  const uint32_t paddleBytes = PADDLE_WIDTH * PADDLE_HEIGHT * 2;
+  uint32_t screenUs[4], paddleUs[4];
+  ST7735_MeasureRotations(PADDLE_WIDTH, PADDLE_HEIGHT, screenUs, paddleUs);
+  userPaddleDirty = true;
+  aiPaddleDirty = true;
+
+  printf("rotation       screen us  kB/s  paddle us  kB/s\n");
+  for (int i = 0; i < 4; i++)
+    printf("%d %-13s %8lu %5lu %10lu %5lu\n", i, names[i], (unsigned long)screenUs[i],
+           (unsigned long)(screenUs[i] ? screenBytes * 1000ull / screenUs[i] : 0),
+           (unsigned long)paddleUs[i],
+           (unsigned long)(paddleUs[i] ? paddleBytes * 1000ull / paddleUs[i] : 0));
+}
+
+// Time a screen of pixels on the display bus the firmware was built with;
+// build with ST7735_USE_PIO set to compare the PIO bus against the SPI.
+void reportDisplayBus()
+{
+#if ST7735_USE_PIO
+  const char *bus = "pio";
+  const uint32_t baud = ST7735_PIO_BAUD;
+#else
+  const char *bus = "spi";
+  const uint32_t baud = DEV_SPI_BAUD;
+#endif
+  ST7735_BusTimes times;
+  ST7735_MeasureBus(&times);
+  userPaddleDirty = true;
+  aiPaddleDirty = true;
+
+  const uint32_t us[] = {times.cpuFillUs, times.dmaFillUs, times.writeUs};
+  const char *names[] = {"cpu fill", "dma fill", "cpu writes"};
+  printf("%s bus at %lu kHz, %lu bytes a screen:\n", bus, (unsigned long)(baud / 1000),
+         (unsigned long)times.bytes);
+  for (int i = 0; i < 3; i++)
+    printf("  %-10s %6lu us %6lu kB/s\n", names[i], (unsigned long)us[i],
+           (unsigned long)(us[i] ? times.bytes * 1000ull / us[i] : 0));
+}
+
+// Print the deferred log records (see lib/dlog.h).
+void logTask(void *unused)
+{
+  DLog_Drain(8);
+}
+
+// Cycle accounting once a second: time the executor slept in WFI against the
+// time it spent running tasks and interrupts. Also starts attract mode.
+void powerTask(void *unused)
+{
+  static uint64_t lastTime;
+  static uint64_t lastIdle;
+
+  const uint64_t now = time_us_64();
+  const uint64_t idle = WQ_IdleTimeUs();
+  if (reportLoad && lastTime)
+  {
+    const uint32_t mhz = clock_get_hz(clk_sys) / 1000000;
+    const uint32_t idleUs = idle - lastIdle;
+    const uint32_t busyUs = (now - lastTime) - idleUs;
+    DLOG3("busy %u idle %u cycles, %u%% idle\n", busyUs * mhz, idleUs * mhz,
+          (uint32_t)((uint64_t)idleUs * 100 / (now - lastTime)));
+  }
+  lastTime = now;
+  lastIdle = idle;
+
+  const uint32_t quiet = to_ms_since_boot(get_absolute_time()) - lastInputMillis;
+  if (!paused && quiet > ATTRACT_MILLIS)
+    enterPause();
+  else if (!paused && !dimmed && quiet > DIM_MILLIS)
+  {
+    dimmed = true;
+    Backlight_FadeTo(DIM_PERCENT, 1000);
+  }
+}
+
+// The player is active: restore full brightness and restart the dim and
+// attract countdowns.
+void noteInput()
+{
+  lastInputMillis = to_ms_since_boot(get_absolute_time());
+  if (dimmed)
+  {
+    dimmed = false;
+    Backlight_FadeTo(100, 150);
+  }
+}
+
+// While paused, look for a tilt that means someone picked the game up.
+void wakeTask(void *unused)
+{
+  float x, y, z;
+  if (imuPresetPending)
+    applyImuPreset();
+  icm20948AccelRead(&x, &y, &z);
+  if (x > 0.3f || x < -0.3f)
+    leavePause();
+}
+
+// Retune the system clock; clk_peri follows it, so the SPI and I2C dividers
+// have to be reprogrammed.
+void setSystemClock(uint32_t khz)
+{
+  set_sys_clock_khz(khz, true);
+  DEV_Module_ClockChanged();
+  i2c_set_baudrate(i2c0, I2C_BAUD);
+}
 
+// How often the IMU is read: once per output sample of the configured
+// preset, to the nearest millisecond the work queue can time. The game's
+// low-latency preset gives 4 ms, 250 reads of its ~280 samples a second,
+// each one fresh.
+uint32_t imuPeriodMillis()
+{
+  const uint32_t millis = (icm20948SamplePeriodUs() + 500) / 1000;
+  return millis ? millis : 1;
+}
+
+// Switch the IMU to a preset and, with poll, read it at that preset's rate
+// from now on; without, stop reading it. If the bus fails, reads go on at
+// the rate of the preset the IMU last took whole, and the new one is tried
+// again from the IMU and wake tasks.
+void setImuPreset(const ICM20948_ST_CONFIG *preset, bool poll)
+{
+  WQ_CancelPeriodic(&imuWork);
+  imuPresetPending = preset;
+  if (!applyImuPreset())
+    DLOG0("imu preset not written, retrying\n");
+  if (poll)
+    WQ_StartPeriodic(&imuWork, imuPeriodMillis());
+}
+
+// Write the pending preset. Returns true once it is in, false while the bus
+// keeps refusing it; the driver holds retries off for ICM20948_I2C_RETRY_MS.
+bool applyImuPreset()
+{
+  if (icm20948Configure(imuPresetPending) != PICO_OK)
+    return false;
+  imuPresetPending = NULL;
   return true;
 }
 
-// Kick the watchdog unless a clean reset was requested.
+void enterPause()
+{
+  if (paused)
+    return;
+  paused = true;
+  DLOG0("paused\n");
+
+  WQ_CancelPeriodic(&ballWork);
+  WQ_CancelPeriodic(&userPaddleWork);
+  WQ_CancelPeriodic(&aiPaddleWork);
+  WQ_CancelPeriodic(&repaintWork);
+  Backlight_Set(0);
+  ST7735_FxReset();
+  ST7735_Sleep(true);
+  // The wake task polls the accelerometer from here on
+  setImuPreset(&gstIcm20948LowPower, false);
+  icm20948SetLowPower(true);
+#if SCALE_CLOCK_WHEN_PAUSED
+  setSystemClock(PAUSE_CLOCK_KHZ);
+#endif
+  WQ_StartPeriodic(&wakeWork, WAKE_POLL_MILLIS);
+}
+
+void leavePause()
+{
+  if (!paused)
+    return;
+
+  WQ_CancelPeriodic(&wakeWork);
+#if SCALE_CLOCK_WHEN_PAUSED
+  setSystemClock(RUN_CLOCK_KHZ);
+#endif
+  icm20948SetLowPower(false);
+  setImuPreset(&gstIcm20948LowLatency, true);
+  ST7735_Sleep(false);
+
+  // Start a fresh round
+  GameDisplay_FillScreen(ST7735_BLACK);
+  resetGameState();
+  noteInput();
+  dimmed = false;
+  Backlight_FadeTo(100, 300);
+  paused = false;
+  DLOG0("resumed\n");
+
+  WQ_StartPeriodic(&ballWork, TICK_MILLIS);
+  WQ_StartPeriodic(&userPaddleWork, TICK_MILLIS);
+  WQ_StartPeriodic(&aiPaddleWork, TICK_MILLIS * 3);
+  WQ_StartPeriodic(&repaintWork, TICK_MILLIS);
+}
+
+// Kick the watchdog while the main loop is alive. Before the game starts the
+// init sequence blocks for long stretches, so it is kicked unconditionally.
 bool monitoringTask()
 {
-  if (shouldCleanReset)
+  static uint32_t lastBeat, lastCompleted;
+  const uint32_t now = to_ms_since_boot(get_absolute_time());
+  const uint32_t completed = WQ_Completed();
+
+  if (!gameStarted || completed != lastCompleted)
   {
-    // Causes the watchdog to reset
-    sleep_ms(WATCHDOG_MILLIS);
+    lastCompleted = completed;
+    lastBeat = now;
   }
-  watchdog_update();
+  if (now - lastBeat < HANG_MILLIS)
+    watchdog_update();
   return true;
 }
 
 
 // Painting
 // -----------------------------------------------------------------------------
+// All coordinates are in landscape game space (see lib/st7735_game.h).
 void paintUserPaddle()
 {
   // Clear area above paddle
-  ST7735_FillRectangle(
-      ST7735_WIDTH - userPaddleY,
-      0,
-      userPaddleY,
-      PADDLE_WIDTH,
-      ST7735_BLACK);
+  GameDisplay_FrameFill(0, 0, PADDLE_WIDTH, userPaddleY, ST7735_BLACK);
   // Clear area below paddle
-  ST7735_FillRectangle(
-      0,
+  GameDisplay_FrameFill(
       0,
-      ST7735_WIDTH - userPaddleY - ST7735_WIDTH,
+      userPaddleY + PADDLE_HEIGHT,
       PADDLE_WIDTH,
+      GAME_HEIGHT - PADDLE_HEIGHT - userPaddleY,
       ST7735_BLACK);
   // Paint user paddle
-  ST7735_FillRectangle(
-      ST7735_WIDTH - PADDLE_HEIGHT - userPaddleY,
-      0,
-      PADDLE_HEIGHT,
-      PADDLE_WIDTH,
-      ST7735_YELLOW);
+  GameDisplay_FrameFill(0, userPaddleY, PADDLE_WIDTH, PADDLE_HEIGHT, ST7735_YELLOW);
 }
 
 void paintAiPaddle()
 {
   // Clear paddle area
-  const uint16_t y = ST7735_HEIGHT - PADDLE_WIDTH;
-  ST7735_FillRectangle(0, y, ST7735_WIDTH, PADDLE_WIDTH, ST7735_BLACK);
+  const uint16_t x = GAME_WIDTH - PADDLE_WIDTH;
+  GameDisplay_FrameFill(x, 0, PADDLE_WIDTH, GAME_HEIGHT, ST7735_BLACK);
   // paint ai paddle
-  ST7735_FillRectangle(
-      ST7735_WIDTH - PADDLE_HEIGHT - aiPaddleY,
-      ST7735_HEIGHT - PADDLE_WIDTH,
-      PADDLE_HEIGHT,
-      PADDLE_WIDTH,
-      ST7735_YELLOW);
+  GameDisplay_FrameFill(x, aiPaddleY, PADDLE_WIDTH, PADDLE_HEIGHT, ST7735_YELLOW);
 }
 
 void paintBall()
 {
   // Clear previous ball position
-  ST7735_FillRectangle(
-      ST7735_WIDTH - BALL_SIZE - prevBallY,
-      prevBallX,
-      BALL_SIZE,
-      BALL_SIZE,
-      ST7735_BLACK);
+  GameDisplay_FrameFill(prevBallX, prevBallY, BALL_SIZE, BALL_SIZE, ST7735_BLACK);
   // Paint ball
-  ST7735_FillRectangle(
-      ST7735_WIDTH - BALL_SIZE - ballY,
-      ballX,
-      BALL_SIZE,
-      BALL_SIZE,
-      ST7735_GREEN);
+  GameDisplay_FrameFill(ballX, ballY, BALL_SIZE, BALL_SIZE, ST7735_GREEN);
 }
 
 void paintDivider()
 {
   // Line to split the screen
-  for (uint16_t x = 0; x <= ST7735_WIDTH; x++)
-  {
-    ST7735_DrawPixel(x, ST7735_HEIGHT / 2, ST7735_WHITE);
-  }
+  GameDisplay_FrameFill(GAME_WIDTH / 2, 0, 1, GAME_HEIGHT, ST7735_WHITE);
 }
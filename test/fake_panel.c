@@ -0,0 +1,101 @@
+/* vim: set ai et ts=4 sw=4: */
+#include "fake_panel.h"
+
+#include <assert.h>
+
+#include "DEV_Config.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+FakePanel_Byte fakePanelBus[FAKE_PANEL_MAX_BYTES];
+size_t fakePanelLen;
+
+static uint32_t now;
+static bool dc;
+
+int EPD_RST_PIN = 12;
+int EPD_DC_PIN = 8;
+int EPD_CS_PIN = 9;
+int EPD_CLK_PIN = 10;
+int EPD_MOSI_PIN = 11;
+
+void FakePanel_Clear(void) {
+    fakePanelLen = 0;
+}
+
+size_t FakePanel_DataRun(size_t pos) {
+    size_t end = pos;
+    while(end < fakePanelLen && fakePanelBus[end].dc) end++;
+    return end - pos;
+}
+
+static void record(const uint8_t *src, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        assert(fakePanelLen < FAKE_PANEL_MAX_BYTES);
+        fakePanelBus[fakePanelLen].byte = src[i];
+        fakePanelBus[fakePanelLen].dc = dc;
+        fakePanelLen++;
+    }
+}
+
+UBYTE DEV_Module_Init(void) { return 0; }
+
+void DEV_Digital_Write(UWORD Pin, UBYTE Value) {
+    if(Pin == EPD_DC_PIN) dc = Value;
+}
+
+uint32_t time_us_32(void) { return now; }
+void busy_wait_us_32(uint32_t us) { now += us; }
+void sleep_ms(uint32_t ms) { now += ms * 1000; }
+void sleep_us(uint64_t us) { now += us; }
+
+uint32_t save_and_disable_interrupts(void) { return 0; }
+void restore_interrupts(uint32_t status) {}
+
+static spi_hw_t spiHw;
+
+spi_hw_t *spi_get_hw(spi_inst_t *spi) { return &spiHw; }
+uint spi_get_dreq(spi_inst_t *spi, bool is_tx) { return 0; }
+bool spi_is_busy(const spi_inst_t *spi) { return false; }
+bool spi_is_readable(const spi_inst_t *spi) { return false; }
+
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len) {
+    record(src, len);
+    return len;
+}
+
+// A DMA transfer is recorded when it is started; repeated transfers (a
+// 2-byte read ring) send the pattern count/2 times
+static bool ring;
+
+int dma_claim_unused_channel(bool required) { return 0; }
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    ring = false;
+    return (dma_channel_config){ 0 };
+}
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) {}
+void channel_config_set_dreq(dma_channel_config *c, uint dreq) {}
+void channel_config_set_ring(dma_channel_config *c, bool write, uint size_bits) { ring = true; }
+
+// Transfers finish as soon as they start. The completion interrupt never
+// fires; ST7735_WaitIdle steps queued transfers itself when it finds the
+// channel idle.
+static bool dmaDone;
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger) {
+    const uint8_t *src = (const uint8_t *)read_addr;
+    for(uint i = 0; i < transfer_count; i++) {
+        record(&src[ring ? i % 2 : i], 1);
+    }
+    dmaDone = true;
+}
+
+bool dma_channel_is_busy(uint channel) { return false; }
+void dma_channel_wait_for_finish_blocking(uint channel) {}
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) {}
+void dma_channel_acknowledge_irq0(uint channel) { dmaDone = false; }
+bool dma_channel_get_irq0_status(uint channel) { return dmaDone; }
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) {}
+void irq_set_enabled(uint num, bool enabled) {}
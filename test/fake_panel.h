@@ -0,0 +1,27 @@
+/* vim: set ai et ts=4 sw=4: */
+#ifndef __FAKE_PANEL_H__
+#define __FAKE_PANEL_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Stands in for the SDK and DEV_Config calls st7735.c makes, recording every
+// byte written to the panel with the DC level it went out with. DMA
+// transfers complete at once. The clock only moves in sleep_ms.
+
+typedef struct {
+    uint8_t byte;
+    bool dc;
+} FakePanel_Byte;
+
+#define FAKE_PANEL_MAX_BYTES 65536
+
+extern FakePanel_Byte fakePanelBus[FAKE_PANEL_MAX_BYTES];
+extern size_t fakePanelLen;
+
+void FakePanel_Clear(void);
+// Data bytes on the bus from pos up to the next command
+size_t FakePanel_DataRun(size_t pos);
+
+#endif // __FAKE_PANEL_H__
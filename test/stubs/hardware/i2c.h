@@ -0,0 +1,18 @@
+#ifndef __HARDWARE_I2C_H__
+#define __HARDWARE_I2C_H__
+
+#include "pico/stdlib.h"
+
+typedef struct i2c_inst i2c_inst_t;
+#define i2c0 ((i2c_inst_t *)0)
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+void i2c_deinit(i2c_inst_t *i2c);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop);
+int i2c_write_timeout_us(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len,
+                         bool nostop, uint timeout_us);
+int i2c_read_timeout_us(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len,
+                        bool nostop, uint timeout_us);
+
+#endif // __HARDWARE_I2C_H__
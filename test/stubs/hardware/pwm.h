@@ -0,0 +1,6 @@
+#ifndef __HARDWARE_PWM_H__
+#define __HARDWARE_PWM_H__
+
+#include "pico/stdlib.h"
+
+#endif // __HARDWARE_PWM_H__
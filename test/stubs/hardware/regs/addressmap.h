@@ -0,0 +1,8 @@
+#ifndef __HARDWARE_REGS_ADDRESSMAP_H__
+#define __HARDWARE_REGS_ADDRESSMAP_H__
+
+#define XIP_BASE                 0x10000000
+#define XIP_NOALLOC_BASE         0x11000000
+#define XIP_NOCACHE_NOALLOC_BASE 0x13000000
+
+#endif // __HARDWARE_REGS_ADDRESSMAP_H__
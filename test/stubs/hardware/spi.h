@@ -0,0 +1,23 @@
+#ifndef __HARDWARE_SPI_H__
+#define __HARDWARE_SPI_H__
+
+#include "pico/stdlib.h"
+
+typedef struct spi_inst spi_inst_t;
+#define spi0 ((spi_inst_t *)0)
+#define spi1 ((spi_inst_t *)1)
+
+typedef struct {
+    volatile uint32_t dr;
+    volatile uint32_t icr;
+} spi_hw_t;
+
+#define SPI_SSPICR_RORIC_BITS 0x1
+
+spi_hw_t *spi_get_hw(spi_inst_t *spi);
+uint spi_get_dreq(spi_inst_t *spi, bool is_tx);
+bool spi_is_busy(const spi_inst_t *spi);
+bool spi_is_readable(const spi_inst_t *spi);
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len);
+
+#endif // __HARDWARE_SPI_H__
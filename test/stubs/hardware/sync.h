@@ -0,0 +1,9 @@
+#ifndef __HARDWARE_SYNC_H__
+#define __HARDWARE_SYNC_H__
+
+#include <stdint.h>
+
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
+
+#endif // __HARDWARE_SYNC_H__
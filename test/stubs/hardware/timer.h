@@ -0,0 +1,9 @@
+#ifndef __HARDWARE_TIMER_H__
+#define __HARDWARE_TIMER_H__
+
+#include <stdint.h>
+
+uint32_t time_us_32(void);
+void busy_wait_us_32(uint32_t us);
+
+#endif // __HARDWARE_TIMER_H__
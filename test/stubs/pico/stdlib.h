@@ -0,0 +1,27 @@
+// Host stand-in for the parts of the Pico SDK the tested modules use. Only
+// declarations: each test defines the functions its module calls, usually
+// to record them or to step a fake clock.
+#ifndef __PICO_STDLIB_H__
+#define __PICO_STDLIB_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "pico/time.h"
+#include "hardware/gpio.h"
+
+typedef unsigned int uint;
+
+#define PICO_OK 0
+#define PICO_ERROR_GENERIC -1
+#define PICO_ERROR_TIMEOUT -2
+
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+void sleep_ms(uint32_t ms);
+void sleep_us(uint64_t us);
+static inline void tight_loop_contents(void) {}
+
+#endif // __PICO_STDLIB_H__
@@ -0,0 +1,8 @@
+#ifndef __PICO_TIME_H__
+#define __PICO_TIME_H__
+
+#include <stdint.h>
+
+#include "hardware/timer.h"
+
+#endif // __PICO_TIME_H__
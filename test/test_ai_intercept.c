@@ -0,0 +1,215 @@
+/* vim: set ai et ts=4 sw=4: */
+// Ai_InterceptY against the ball run forward a tick at a time, the way
+// ballTask moves it: a wall check, then a step on each axis. Also the host
+// time of an AI tick, the predictive one against the old chase.
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "ai.h"
+
+// The game's court: 160 wide less a paddle and the ball, 80 high less the ball
+#define TARGET_X (160 - 10 - 5)
+#define RANGE (80 - 5)
+#define PADDLE_HEIGHT 30
+#define MAX_PADDLE_Y (80 - PADDLE_HEIGHT)
+#define BALL_SIZE 5
+
+static int bounces;
+
+static int simulate(int x, int y, int dx, int dy, int targetX, int range) {
+    if(dx <= 0)
+        return y;
+    while(x < targetX) {
+        if(y >= range || y <= 0) {
+            dy = -dy;
+            bounces++;
+        }
+        x += dx;
+        y += dy;
+    }
+    return y;
+}
+
+// Every start the ball can be in, for each court size and horizontal speed.
+// A ball on a wall is still moving into it: ballTask turns it on the next
+// tick, whichever way it is going, so a ball leaving a wall never sits on it.
+static void testAgainstSimulation(void) {
+    static const int ranges[] = { RANGE, 7, 1 };
+    int checked = 0, mostBounces = 0;
+    for(size_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++) {
+        const int range = ranges[r];
+        for(int dx = 1; dx <= 3; dx++) {
+            for(int x = 0; x <= TARGET_X + 2; x++) {
+                for(int y = 0; y <= range; y++) {
+                    for(int dy = -1; dy <= 1; dy += 2) {
+                        if((y == 0 && dy > 0) || (y == range && dy < 0))
+                            continue;
+                        bounces = 0;
+                        const int expected = simulate(x, y, dx, dy, TARGET_X, range);
+                        assert(Ai_InterceptY(x, y, dx, dy, TARGET_X, range) == expected);
+                        if(bounces > mostBounces) mostBounces = bounces;
+                        checked++;
+                    }
+                }
+            }
+        }
+    }
+    printf("%d starts checked, up to %d wall bounces\n", checked, mostBounces);
+    assert(mostBounces > 2);
+}
+
+// Hand-worked cases on the game's court
+static void testKnown(void) {
+    // Straight down from the middle: one bounce off the bottom
+    assert(Ai_InterceptY(80, 35, 1, 1, TARGET_X, RANGE) == 2 * RANGE - (35 + 65));
+    // From the far side, turning off the top: down the court and nearly back
+    assert(Ai_InterceptY(0, 0, 1, -1, TARGET_X, RANGE) == 2 * RANGE - TARGET_X);
+    // Twice as fast across, so half the ticks
+    assert(Ai_InterceptY(5, 10, 2, -1, TARGET_X, RANGE) == 60);
+}
+
+// A ball standing still or heading away never arrives
+static void testNotApproaching(void) {
+    for(int y = 0; y <= RANGE; y++) {
+        assert(Ai_InterceptY(40, y, 0, 1, TARGET_X, RANGE) == y);
+        assert(Ai_InterceptY(40, y, -1, -1, TARGET_X, RANGE) == y);
+        assert(Ai_InterceptY(40, y, -3, 1, TARGET_X, RANGE) == y);
+    }
+    // Already at the paddle
+    assert(Ai_InterceptY(TARGET_X, 12, 1, 1, TARGET_X, RANGE) == 12);
+}
+
+// Game state as main.c keeps it, volatile where the firmware's is
+static volatile uint16_t ballX, ballY, aiPaddleY;
+static volatile int ballMagnitudeX, ballMagnitudeY;
+static volatile int aiPaddleDirty;
+// Keeps the bare Ai_InterceptY calls from being optimised away
+static volatile int interceptSink;
+static int32_t aiPaddleQ8, aiTargetQ8;
+static int aiSeenDirection, aiPlanPending;
+static uint32_t aiPlanAt, aiRandomState = 0x2545f491;
+
+// The baseline's aiPaddleTask: chase the ball 2 px a tick
+static void oldChase(void) {
+    uint16_t paddleCenterY = aiPaddleY + (PADDLE_HEIGHT / 2);
+    uint16_t ballCenterY = ballY + (BALL_SIZE / 2);
+    int delta = paddleCenterY - ballCenterY;
+    uint16_t step = 2;
+    if(delta > 0 && aiPaddleY >= step) {
+        aiPaddleDirty = 1;
+        aiPaddleY -= step;
+    }
+    if(delta < 0 && aiPaddleY + PADDLE_HEIGHT + step <= 80) {
+        aiPaddleDirty = 1;
+        aiPaddleY += step;
+    }
+}
+
+// aiPaddleTask and aiPlan from main.c at the normal skill
+static void aiPlan(void) {
+    int target = MAX_PADDLE_Y / 2;
+    if(ballMagnitudeX > 0) {
+        const int error = 5;
+        target = Ai_InterceptY(ballX, ballY, ballMagnitudeX, ballMagnitudeY, TARGET_X, RANGE)
+                 + BALL_SIZE / 2 - PADDLE_HEIGHT / 2;
+        aiRandomState ^= aiRandomState << 13;
+        aiRandomState ^= aiRandomState >> 17;
+        aiRandomState ^= aiRandomState << 5;
+        target += (int)(aiRandomState % (2 * error + 1)) - error;
+    }
+    if(target < 0) target = 0;
+    if(target > MAX_PADDLE_Y) target = MAX_PADDLE_Y;
+    aiTargetQ8 = target << 8;
+}
+
+static void newTick(uint32_t now) {
+    if(ballMagnitudeX != aiSeenDirection) {
+        aiSeenDirection = ballMagnitudeX;
+        aiPlanAt = now + 150;
+        aiPlanPending = 1;
+    }
+    if(aiPlanPending && (int32_t)(now - aiPlanAt) >= 0) {
+        aiPlanPending = 0;
+        aiPlan();
+    }
+    int32_t delta = aiTargetQ8 - aiPaddleQ8;
+    if(delta > 512) delta = 512;
+    if(delta < -512) delta = -512;
+    aiPaddleQ8 += delta;
+    const uint16_t y = aiPaddleQ8 >> 8;
+    if(y != aiPaddleY) {
+        aiPaddleY = y;
+        aiPaddleDirty = 1;
+    }
+}
+
+// The ball at each AI tick (every third ball tick, 48 ms) of a rally that
+// bounces off both ends, so the new AI replans as often as it would in play
+#define BENCH_TICKS 4096
+static uint16_t rallyX[BENCH_TICKS], rallyY[BENCH_TICKS];
+static int8_t rallyDx[BENCH_TICKS], rallyDy[BENCH_TICKS];
+
+static void recordRally(void) {
+    int x = 80, y = 35, dx = 1, dy = 1;
+    for(int i = 0; i < BENCH_TICKS; i++) {
+        for(int t = 0; t < 3; t++) {
+            if(y >= RANGE || y <= 0) dy = -dy;
+            if(x >= TARGET_X || x <= 10) dx = -dx;
+            x += dx;
+            y += dy;
+        }
+        rallyX[i] = x;
+        rallyY[i] = y;
+        rallyDx[i] = dx;
+        rallyDy[i] = dy;
+    }
+}
+
+static void setBall(int i) {
+    ballX = rallyX[i];
+    ballY = rallyY[i];
+    ballMagnitudeX = rallyDx[i];
+    ballMagnitudeY = rallyDy[i];
+}
+
+// Host ns per tick, less the cost of replaying the rally. For comparing the
+// two, not for the board: the tick runs every 48 ms there either way.
+static double timeTicks(int which) {
+    const int rounds = 2000;
+    clock_t start = clock();
+    for(int r = 0; r < rounds; r++) {
+        for(int i = 0; i < BENCH_TICKS; i++) {
+            setBall(i);
+            if(which == 1)
+                oldChase();
+            else if(which == 2)
+                newTick((uint32_t)i * 48);
+            else if(which == 3)
+                interceptSink = Ai_InterceptY(ballX, ballY, ballMagnitudeX, ballMagnitudeY,
+                                              TARGET_X, RANGE);
+        }
+    }
+    return (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / rounds / BENCH_TICKS;
+}
+
+static void benchmark(void) {
+    recordRally();
+    const double replay = timeTicks(0);
+    const double chase = timeTicks(1) - replay;
+    const double tick = timeTicks(2) - replay;
+    const double intercept = timeTicks(3) - replay;
+    printf("ai tick on the host: old chase %.1f ns, predictive %.1f ns, "
+           "Ai_InterceptY alone %.1f ns\n", chase, tick, intercept);
+}
+
+int main(void) {
+    testAgainstSimulation();
+    testKnown();
+    testNotApproaching();
+    benchmark();
+
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,135 @@
+/* vim: set ai et ts=4 sw=4: */
+// The 4bpp framebuffer with the portable expansion: packing of pixels and
+// clipped rectangles, the RGB565 a flush puts on the panel, palette swaps
+// that recolour without a buffer write, and the bytes and time per frame.
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "fake_panel.h"
+#include "framebuffer.h"
+
+// The frame as the test believes it to be, one index per pixel
+static uint8_t model[FB_HEIGHT][FB_WIDTH];
+static uint16_t colors[FB_PALETTE_LEN];
+
+static void modelFill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t index) {
+    for(uint32_t row = y; row < (uint32_t)y + h && row < FB_HEIGHT; row++)
+        for(uint32_t col = x; col < (uint32_t)x + w && col < FB_WIDTH; col++)
+            model[row][col] = index;
+}
+
+static void setPalette(uint8_t index, uint16_t color) {
+    FB_SetPalette(index, color);
+    colors[index] = color;
+}
+
+// A flush must send the model's colours, big-endian, for the whole panel
+static void expectFlush(void) {
+    FakePanel_Clear();
+    FB_Flush();
+    size_t pos = 0;
+    while(fakePanelBus[pos].dc || fakePanelBus[pos].byte != ST7735_RAMWR) {
+        pos++;
+        assert(pos < fakePanelLen);
+    }
+    pos++;
+    assert(FakePanel_DataRun(pos) == FB_WIDTH * FB_HEIGHT * 2);
+    for(uint16_t y = 0; y < FB_HEIGHT; y++) {
+        for(uint16_t x = 0; x < FB_WIDTH; x++, pos += 2) {
+            const uint16_t color = colors[model[y][x]];
+            assert(fakePanelBus[pos].byte == color >> 8);
+            assert(fakePanelBus[pos + 1].byte == (color & 0xFF));
+        }
+    }
+}
+
+// Distinct bytes in every entry, so a swapped or shifted lookup shows
+static void loadPalette(void) {
+    for(uint8_t i = 0; i < FB_PALETTE_LEN; i++) setPalette(i, (uint16_t)(i * 0x1111 + 0x0102));
+}
+
+static void testDrawing(void) {
+    loadPalette();
+    FB_Fill(3);
+    modelFill(0, 0, FB_WIDTH, FB_HEIGHT, 3);
+
+    // Odd and even edges on both sides, clipped at the right and bottom
+    static const uint16_t rects[][5] = {
+        { 0, 0, 1, 1, 1 }, { 1, 2, 1, 3, 2 }, { 3, 4, 6, 2, 4 }, { 4, 7, 5, 1, 5 },
+        { 7, 9, 8, 4, 6 }, { FB_WIDTH - 3, 10, 10, 3, 7 }, { 5, FB_HEIGHT - 2, 9, 9, 8 },
+        { FB_WIDTH, 0, 4, 4, 9 }, { 0, FB_HEIGHT, 4, 4, 9 }, { 20, 20, 0, 0, 9 },
+    };
+    for(size_t i = 0; i < sizeof(rects) / sizeof(rects[0]); i++) {
+        const uint16_t *r = rects[i];
+        FB_FillRectangle(r[0], r[1], r[2], r[3], r[4]);
+        if(r[2] && r[3]) modelFill(r[0], r[1], r[2], r[3], r[4]);
+    }
+    FB_DrawPixel(FB_WIDTH - 1, FB_HEIGHT - 1, 15);
+    FB_DrawPixel(30, 31, 14);
+    FB_DrawPixel(FB_WIDTH, 0, 13);
+    model[FB_HEIGHT - 1][FB_WIDTH - 1] = 15;
+    model[31][30] = 14;
+    expectFlush();
+}
+
+// Recolouring is a palette write; the buffer and its expansion agree after
+static void testPaletteSwap(void) {
+    loadPalette();
+    FB_Fill(FB_BLACK);
+    modelFill(0, 0, FB_WIDTH, FB_HEIGHT, FB_BLACK);
+    FB_FillRectangle(10, 10, 20, 20, FB_RED);
+    modelFill(10, 10, 20, 20, FB_RED);
+    expectFlush();
+
+    setPalette(FB_BLACK, ST7735_RED);
+    setPalette(FB_RED, ST7735_WHITE);
+    expectFlush();
+    assert(FB_GetPalette(FB_BLACK) == ST7735_RED);
+}
+
+// An odd pixel count ends on the low nibble of the last byte
+static void testExpandOdd(void) {
+    const uint8_t src[] = { 0x21, 0x43, 0x05 };
+    uint16_t dst[6];
+    loadPalette();
+    memset(dst, 0xEE, sizeof(dst));
+    FB_ExpandRow(src, dst, 5);
+    static const uint8_t indices[] = { 1, 2, 3, 4, 5 };
+    for(int i = 0; i < 5; i++) {
+        const uint16_t color = colors[indices[i]];
+        assert(dst[i] == (uint16_t)((color >> 8) | (color << 8)));
+    }
+    assert(dst[5] == 0xEEEE);
+}
+
+// Bytes held and sent per frame, and the host's time to expand one. The
+// cycles on the board come from FB_MeasureCost ('e' on the console).
+static void benchmark(void) {
+    static uint8_t packed[FB_STRIDE];
+    static uint16_t row[FB_WIDTH];
+    const int frames = 200;
+    for(size_t i = 0; i < sizeof(packed); i++) packed[i] = (uint8_t)(i * 37);
+    clock_t start = clock();
+    for(int i = 0; i < frames; i++) {
+        for(uint16_t y = 0; y < FB_HEIGHT; y++) FB_ExpandRow(packed, row, FB_WIDTH);
+    }
+    const double us = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / frames;
+    printf("frame: %u bytes buffered, %u as RGB565; host expands one in %.1f us\n",
+           (unsigned)FB_SIZE, (unsigned)(FB_WIDTH * FB_HEIGHT * 2), us);
+}
+
+int main(void) {
+    ST7735_Init();
+    FB_Init();
+    assert(FB_SIZE * 4 == FB_WIDTH * FB_HEIGHT * 2);
+
+    testDrawing();
+    testPaletteSwap();
+    testExpandOdd();
+    benchmark();
+
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,248 @@
+/* vim: set ai et ts=4 sw=4: */
+// ICM-20948 bus error handling against a mock sensor: transfers that time
+// out, SDA held low by a slave cut off mid-byte, the retry hold-off, and the
+// register bank left behind by an interrupted icm20948Configure.
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ICM20948.h"
+
+// Fake clock, advanced by every wait and transfer
+static uint32_t now;
+
+uint32_t time_us_32(void) { return now; }
+void busy_wait_us_32(uint32_t us) { now += us; }
+void sleep_ms(uint32_t ms) { now += ms * 1000; }
+void sleep_us(uint64_t us) { now += us; }
+
+// SDA stays low for this many SCL pulses of a recovery
+static int sdaLowClocks;
+static int sclPulses;
+static bool sclOut;
+
+void gpio_init(unsigned int gpio) {}
+void gpio_set_function(unsigned int gpio, enum gpio_function fn) {}
+void gpio_pull_up(unsigned int gpio) {}
+void gpio_put(unsigned int gpio, bool value) {}
+
+bool gpio_get(unsigned int gpio) {
+    return gpio != ICM20948_SDA_PIN || sdaLowClocks <= 0;
+}
+
+void gpio_set_dir(unsigned int gpio, bool out) {
+    if(gpio != ICM20948_SCL_PIN) return;
+    if(sclOut && !out) {
+        sclPulses++;
+        sdaLowClocks--;
+    }
+    sclOut = out;
+}
+
+// The sensor: a bank select register, bank 0 output registers and a register
+// pointer. Reads from any other bank return junk, as the real part would
+// return whatever lives at that address there.
+static uint8_t bank;
+static uint8_t bank0[128];
+static uint8_t pointer;
+// After passTransfers more good transfers, the next stallTransfers time out
+static int passTransfers;
+static int stallTransfers;
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) { return baudrate; }
+void i2c_deinit(i2c_inst_t *i2c) {}
+
+static bool stall(uint timeout_us) {
+    if(passTransfers > 0) {
+        passTransfers--;
+        return false;
+    }
+    if(stallTransfers <= 0) return false;
+    stallTransfers--;
+    now += timeout_us;
+    return true;
+}
+
+int i2c_write_timeout_us(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len,
+                         bool nostop, uint timeout_us) {
+    if(stall(timeout_us)) return PICO_ERROR_TIMEOUT;
+    now += len * 25;
+    pointer = src[0];
+    if(len == 2 && src[0] == REG_ADD_REG_BANK_SEL) bank = src[1];
+    else if(len == 2 && bank == REG_VAL_REG_BANK_0) bank0[src[0] & 0x7F] = src[1];
+    return len;
+}
+
+int i2c_read_timeout_us(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len,
+                        bool nostop, uint timeout_us) {
+    if(stall(timeout_us)) return PICO_ERROR_TIMEOUT;
+    now += len * 25;
+    for(size_t i = 0; i < len; i++) {
+        dst[i] = bank == REG_VAL_REG_BANK_0 ? bank0[(pointer + i) & 0x7F] : 0x5A;
+    }
+    return len;
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    return len;
+}
+
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop) {
+    return len;
+}
+
+// Accel x in counts; 8192 is 1000 mg in the low-latency preset's 4 g range
+static void setAccelX(int16_t counts) {
+    bank0[REG_ADD_ACCEL_XOUT_H] = (uint16_t)counts >> 8;
+    bank0[REG_ADD_ACCEL_XOUT_H + 1] = counts & 0xFF;
+}
+
+static void waitForRetry(void) {
+    now += ICM20948_I2C_RETRY_MS * 1000;
+}
+
+static void testGoodRead(void) {
+    ICM20948_ST_MOTION motion = { 0 };
+    setAccelX(8192);
+    assert(icm20948MotionRead(&motion));
+    assert(motion.s32AccelMg[0] == 1000);
+    assert(bank == REG_VAL_REG_BANK_0);
+}
+
+static void testStallRecovers(void) {
+    const ICM20948_ST_BUS_STATS *stats = icm20948BusStats();
+    ICM20948_ST_MOTION motion = { 0 };
+    setAccelX(8192);
+    assert(icm20948MotionRead(&motion));
+    const ICM20948_ST_MOTION good = motion;
+    const uint32_t timeouts = stats->u32Timeouts;
+    const uint32_t recoveries = stats->u32Recoveries;
+
+    // The register write times out with SDA held for three clocks
+    setAccelX(4096);
+    stallTransfers = 1;
+    sdaLowClocks = 3;
+    sclPulses = 0;
+    uint32_t start = now;
+    assert(!icm20948MotionRead(&motion));
+    uint32_t took = now - start;
+    printf("failed read: %u us, %d SCL pulses\n", (unsigned)took, sclPulses);
+    // One timeout plus the recovery and the bank write, then nothing more
+    assert(took >= ICM20948_I2C_TIMEOUT_US && took < ICM20948_I2C_TIMEOUT_US + 500);
+    // Three to free SDA and one for the STOP
+    assert(sclPulses == 4);
+    assert(stats->u32Timeouts == timeouts + 1);
+    assert(stats->u32Recoveries == recoveries + 1);
+    assert(memcmp(&motion, &good, sizeof(motion)) == 0);
+    assert(bank == REG_VAL_REG_BANK_0);
+
+    // Held off until the retry period is up, at no cost
+    const uint32_t skipped = stats->u32Skipped;
+    start = now;
+    assert(!icm20948MotionRead(&motion));
+    assert(now == start);
+    assert(stats->u32Skipped == skipped + 1);
+
+    waitForRetry();
+    assert(icm20948MotionRead(&motion));
+    assert(motion.s32AccelMg[0] == 500);
+}
+
+// A timeout between the bank switches of icm20948Configure used to leave
+// the sensor in bank 2, and every later read returned junk without error.
+// The error is reported and the driver keeps the setting it had, so reads
+// are still scaled for the full scale the sensor was last given whole.
+static void testConfigureCutOffInBank2(void) {
+    ICM20948_ST_MOTION motion = { 0 };
+    waitForRetry();
+    setAccelX(8192);
+
+    // The bank 2 select goes through, the first register write does not
+    passTransfers = 1;
+    stallTransfers = 1;
+    assert(icm20948Configure(&gstIcm20948LowNoise) == PICO_ERROR_TIMEOUT);
+    assert(bank == REG_VAL_REG_BANK_0);
+    assert(icm20948GetConfig()->u8AccelFs == gstIcm20948LowLatency.u8AccelFs);
+    assert(icm20948SamplePeriodUs() == 889 * 4);
+
+    // Refused at once while the bus is down, and nothing changes
+    assert(icm20948Configure(&gstIcm20948LowNoise) == PICO_ERROR_TIMEOUT);
+    assert(icm20948GetConfig()->u8AccelFs == gstIcm20948LowLatency.u8AccelFs);
+
+    waitForRetry();
+    assert(icm20948MotionRead(&motion));
+    assert(motion.s32AccelMg[0] == 1000);
+
+    // Once it gets through, reads follow the new setting's 2 g
+    assert(icm20948Configure(&gstIcm20948LowNoise) == PICO_OK);
+    assert(icm20948MotionRead(&motion));
+    assert(motion.s32AccelMg[0] == 500);
+    assert(icm20948Configure(&gstIcm20948LowLatency) == PICO_OK);
+}
+
+// If the bank write after a recovery fails too, it is made again before the
+// first transfer once the bus is retried.
+static void testBankRestoreRetried(void) {
+    const ICM20948_ST_BUS_STATS *stats = icm20948BusStats();
+    ICM20948_ST_MOTION motion = { 0 };
+    waitForRetry();
+    setAccelX(8192);
+
+    // Cut off in bank 2, and the bank write after the recovery times out too
+    const uint32_t timeouts = stats->u32Timeouts;
+    passTransfers = 1;
+    stallTransfers = 2;
+    assert(icm20948Configure(&gstIcm20948LowLatency) != PICO_OK);
+    assert(bank == REG_VAL_REG_BANK_2);
+    assert(stats->u32Timeouts == timeouts + 1);
+
+    waitForRetry();
+    assert(icm20948MotionRead(&motion));
+    assert(bank == REG_VAL_REG_BANK_0);
+    assert(motion.s32AccelMg[0] == 1000);
+}
+
+// Reads are timed from the faster sensor's output period: the low-latency
+// preset's accelerometer at 1125 / 4 Hz, the low-power one's gyro at 1100 / 44
+static void testSamplePeriod(void) {
+    assert(icm20948Configure(&gstIcm20948LowPower) == PICO_OK);
+    assert(icm20948SamplePeriodUs() == 909 * 44);
+    assert(icm20948Configure(&gstIcm20948LowLatency) == PICO_OK);
+    assert(icm20948SamplePeriodUs() == 889 * 4);
+}
+
+// A sensor that never answers costs a bounded share of every second, well
+// inside the watchdog period at any one call.
+static void testDeadBus(void) {
+    ICM20948_ST_MOTION motion = { 0 };
+    waitForRetry();
+    stallTransfers = 1 << 30;
+    uint32_t busy = 0, worst = 0;
+    for(int i = 0; i < 1000000 / 3600; i++) {
+        uint32_t start = now;
+        icm20948MotionRead(&motion);
+        uint32_t took = now - start;
+        busy += took;
+        if(took > worst) worst = took;
+        now += 3600;
+    }
+    printf("dead bus: %u us busy per second, worst call %u us\n", (unsigned)busy, (unsigned)worst);
+    assert(worst < 3 * ICM20948_I2C_TIMEOUT_US);
+    assert(busy < 1000000 / ICM20948_I2C_RETRY_MS / 1000 * 3 * ICM20948_I2C_TIMEOUT_US);
+    stallTransfers = 0;
+}
+
+int main(void) {
+    icm20948BusInit(400 * 1000);
+    assert(icm20948Configure(&gstIcm20948LowLatency) == PICO_OK);
+
+    testGoodRead();
+    testStallRecovers();
+    testConfigureCutOffInBank2();
+    testBankRestoreRetried();
+    testSamplePeriod();
+    testDeadBus();
+
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,264 @@
+/* vim: set ai et ts=4 sw=4: */
+// Command list encoder: the bytes and DC levels a list puts on the bus.
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "st7735_cmdlist.h"
+
+// One byte on the bus and the DC level it went out with
+typedef struct {
+    uint8_t byte;
+    bool dc;
+} BusByte;
+
+static BusByte bus[4096];
+static size_t busLen;
+
+// Play the list out the way ST7735_RunCommandList does, with repeated
+// segments sending their 2-byte pattern len/2 times
+static void play(const ST7735_CmdList *list) {
+    busLen = 0;
+    for(uint16_t i = 0; i < list->count; i++) {
+        const ST7735_CmdSegment *seg = &list->segments[i];
+        assert(!seg->repeat || seg->len % 2 == 0);
+        for(uint32_t j = 0; j < seg->len; j++) {
+            assert(busLen < sizeof(bus) / sizeof(bus[0]));
+            bus[busLen].byte = seg->data[seg->repeat ? j % 2 : j];
+            bus[busLen].dc = seg->dc;
+            busLen++;
+        }
+    }
+}
+
+// Expect a command and its arguments at *pos on the bus
+static void expectCommand(size_t *pos, uint8_t cmd, const uint8_t *args, size_t numArgs) {
+    assert(*pos + 1 + numArgs <= busLen);
+    assert(bus[*pos].byte == cmd && !bus[*pos].dc);
+    for(size_t i = 0; i < numArgs; i++) {
+        assert(bus[*pos + 1 + i].byte == args[i] && bus[*pos + 1 + i].dc);
+    }
+    *pos += 1 + numArgs;
+}
+
+// Expect a window over w x h at x, y in the list's geometry, then RAMWR
+static void expectWindow(size_t *pos, const ST7735_Geometry *g, uint16_t x, uint16_t y,
+                         uint16_t w, uint16_t h) {
+    const uint8_t cols[] = { 0x00, x + g->xstart, 0x00, x + w - 1 + g->xstart };
+    const uint8_t rows[] = { 0x00, y + g->ystart, 0x00, y + h - 1 + g->ystart };
+    expectCommand(pos, ST7735_CASET, cols, sizeof(cols));
+    expectCommand(pos, ST7735_RASET, rows, sizeof(rows));
+    expectCommand(pos, ST7735_RAMWR, NULL, 0);
+}
+
+// Expect count pixels of one color, big-endian, with DC high
+static void expectFill(size_t *pos, uint16_t color, uint32_t count) {
+    assert(*pos + 2 * count <= busLen);
+    for(uint32_t i = 0; i < count; i++) {
+        const BusByte *px = &bus[*pos + 2 * i];
+        assert(px[0].byte == color >> 8 && px[0].dc);
+        assert(px[1].byte == (color & 0xFF) && px[1].dc);
+    }
+    *pos += 2 * count;
+}
+
+static void testCommand(void) {
+    ST7735_CmdList list;
+    ST7735_CmdListInit(&list);
+    const uint8_t args[] = { 0x12, 0x34, 0x56 };
+    assert(ST7735_CmdListCommand(&list, ST7735_MADCTL, args, 1));
+    assert(ST7735_CmdListCommand(&list, ST7735_NOP, NULL, 0));
+    assert(ST7735_CmdListCommand(&list, ST7735_VSCRDEF, args, sizeof(args)));
+    // A command and its arguments are separate segments, so DC can change
+    assert(list.count == 5);
+    play(&list);
+
+    size_t pos = 0;
+    expectCommand(&pos, ST7735_MADCTL, args, 1);
+    expectCommand(&pos, ST7735_NOP, NULL, 0);
+    expectCommand(&pos, ST7735_VSCRDEF, args, sizeof(args));
+    assert(pos == busLen);
+    // Arguments are copied, so callers may pass stack buffers
+    for(uint16_t i = 0; i < list.count; i++) {
+        assert(list.segments[i].data < args || list.segments[i].data >= args + sizeof(args));
+    }
+}
+
+static void testFill(void) {
+    ST7735_CmdList list;
+    ST7735_CmdListInit(&list);
+    assert(ST7735_CmdListFillRectangle(&list, 3, 5, 7, 2, 0xF81F));
+    // The fill is one repeated 2-byte pattern, not a pixel per pixel
+    assert(list.count == 6);
+    assert(list.segments[5].repeat && list.segments[5].len == 7 * 2 * 2);
+    assert(((uintptr_t)list.segments[5].data & 1) == 0);
+    play(&list);
+
+    size_t pos = 0;
+    expectWindow(&pos, &list.geometry, 3, 5, 7, 2);
+    expectFill(&pos, 0xF81F, 7 * 2);
+    assert(pos == busLen);
+}
+
+static void testFillClipped(void) {
+    ST7735_CmdList list;
+    ST7735_CmdListInit(&list);
+    const ST7735_Geometry g = list.geometry;
+
+    // Hanging off the bottom right corner
+    assert(ST7735_CmdListFillRectangle(&list, g.width - 2, g.height - 3, 10, 10, 0x07E0));
+    // Wholly off the panel, or empty: nothing
+    assert(ST7735_CmdListFillRectangle(&list, g.width, 0, 4, 4, 0x07E0));
+    assert(ST7735_CmdListFillRectangle(&list, 0, g.height, 4, 4, 0x07E0));
+    assert(ST7735_CmdListFillRectangle(&list, 0, 0, 0, 4, 0x07E0));
+    assert(ST7735_CmdListFillRectangle(&list, 0, 0, 4, 0, 0x07E0));
+    play(&list);
+
+    size_t pos = 0;
+    expectWindow(&pos, &g, g.width - 2, g.height - 3, 2, 3);
+    expectFill(&pos, 0x07E0, 2 * 3);
+    assert(pos == busLen);
+}
+
+// Offsets come from the list's geometry, as set after a rotation
+static void testRotatedGeometry(void) {
+    ST7735_CmdList list;
+    ST7735_CmdListInit(&list);
+    list.geometry = (ST7735_Geometry){ ST7735_HEIGHT, ST7735_WIDTH, 1, 26 };
+    assert(ST7735_CmdListFillRectangle(&list, ST7735_HEIGHT - 1, 0, 4, 1, 0xFFFF));
+    play(&list);
+
+    size_t pos = 0;
+    expectWindow(&pos, &list.geometry, ST7735_HEIGHT - 1, 0, 1, 1);
+    expectFill(&pos, 0xFFFF, 1);
+    assert(pos == busLen);
+}
+
+static void testImage(void) {
+    static const uint8_t pixels[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    ST7735_CmdList list;
+    ST7735_CmdListInit(&list);
+    assert(ST7735_CmdListImage(&list, 1, 2, 2, 2, pixels));
+    // Image data is sent from where it lies, not copied
+    assert(list.segments[list.count - 1].data == pixels);
+    play(&list);
+
+    size_t pos = 0;
+    expectWindow(&pos, &list.geometry, 1, 2, 2, 2);
+    for(size_t i = 0; i < sizeof(pixels); i++, pos++) {
+        assert(bus[pos].byte == pixels[i] && bus[pos].dc);
+    }
+    assert(pos == busLen);
+}
+
+// A fill that does not fit leaves no half-written window behind
+static void testFillOverflow(void) {
+    ST7735_CmdList list;
+    ST7735_CmdListInit(&list);
+    while(ST7735_CmdListFillRectangle(&list, 0, 0, 1, 1, 0x0000)) {
+    }
+    assert(list.overflow);
+    assert(list.count % 6 == 0);
+    play(&list);
+    size_t pos = 0;
+    for(uint16_t i = 0; i < list.count / 6; i++) {
+        expectWindow(&pos, &list.geometry, 0, 0, 1, 1);
+        expectFill(&pos, 0x0000, 1);
+    }
+    assert(pos == busLen);
+}
+
+// The game's repaint puts up to eight fills in one list: three for the
+// user's paddle, two for the AI's, the divider and two for the ball.
+static void testGameFrameFits(void) {
+    ST7735_CmdList list;
+    ST7735_CmdListInit(&list);
+    for(int i = 0; i < 8; i++) {
+        assert(ST7735_CmdListFillRectangle(&list, i, i, 10, 30, 0xFFE0));
+    }
+    assert(!list.overflow);
+}
+
+static void testPartial(void) {
+    ST7735_CmdList list;
+    ST7735_CmdListInit(&list);
+    assert(ST7735_CmdListPartial(&list, 10, 20));
+    play(&list);
+
+    const uint16_t start = 10 + ST7735_YSTART, end = start + 19;
+    const uint8_t area[] = { start >> 8, start & 0xFF, end >> 8, end & 0xFF };
+    size_t pos = 0;
+    expectCommand(&pos, ST7735_PTLAR, area, sizeof(area));
+    expectCommand(&pos, ST7735_PTLON, NULL, 0);
+    assert(pos == busLen);
+    assert(!list.overflow);
+}
+
+static void testPartialClipped(void) {
+    ST7735_CmdList list;
+
+    // Runs off the bottom of the panel
+    ST7735_CmdListInit(&list);
+    assert(ST7735_CmdListPartial(&list, ST7735_HEIGHT - 5, 20));
+    play(&list);
+    const uint16_t start = ST7735_HEIGHT - 5 + ST7735_YSTART, end = ST7735_HEIGHT - 1 + ST7735_YSTART;
+    const uint8_t area[] = { start >> 8, start & 0xFF, end >> 8, end & 0xFF };
+    size_t pos = 0;
+    expectCommand(&pos, ST7735_PTLAR, area, sizeof(area));
+    expectCommand(&pos, ST7735_PTLON, NULL, 0);
+    assert(pos == busLen);
+
+    // Nothing left to show: no commands at all
+    ST7735_CmdListInit(&list);
+    assert(ST7735_CmdListPartial(&list, ST7735_HEIGHT, 10));
+    assert(ST7735_CmdListPartial(&list, 0, 0));
+    assert(list.count == 0);
+}
+
+static void testNormal(void) {
+    ST7735_CmdList list;
+    ST7735_CmdListInit(&list);
+    assert(ST7735_CmdListPartial(&list, 0, 40));
+    assert(ST7735_CmdListNormal(&list));
+    play(&list);
+
+    const uint16_t end = 39 + ST7735_YSTART;
+    const uint8_t area[] = { ST7735_YSTART >> 8, ST7735_YSTART & 0xFF, end >> 8, end & 0xFF };
+    size_t pos = 0;
+    expectCommand(&pos, ST7735_PTLAR, area, sizeof(area));
+    expectCommand(&pos, ST7735_PTLON, NULL, 0);
+    expectCommand(&pos, ST7735_NORON, NULL, 0);
+    assert(pos == busLen);
+}
+
+// A list too full for PTLAR and PTLON together gets neither, so the panel is
+// never left with a new area but partial mode off, or the reverse
+static void testPartialOverflow(void) {
+    ST7735_CmdList list;
+    ST7735_CmdListInit(&list);
+    while(list.count + 3 <= ST7735_CMDLIST_MAX_SEGMENTS) {
+        assert(ST7735_CmdListCommand(&list, ST7735_NOP, NULL, 0));
+    }
+    const uint16_t count = list.count, used = list.used;
+    assert(!ST7735_CmdListPartial(&list, 10, 20));
+    assert(list.overflow);
+    assert(list.count == count && list.used == used);
+}
+
+int main(void) {
+    testCommand();
+    testFill();
+    testFillClipped();
+    testRotatedGeometry();
+    testImage();
+    testFillOverflow();
+    testGameFrameFits();
+    testPartial();
+    testPartialClipped();
+    testNormal();
+    testPartialOverflow();
+
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,148 @@
+/* vim: set ai et ts=4 sw=4: */
+// 12-bit colour: RGB565 pixels packed two to three bytes, with an odd pixel
+// carried into the next write and padded when the write ends.
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "fake_panel.h"
+#include "pico/stdlib.h"
+#include "st7735.h"
+
+// The packing the panel expects, one pixel at a time: the top four bits of
+// each channel, two pixels to three bytes, a lone last pixel in two
+static size_t pack(const uint16_t *pixels, size_t count, uint8_t *out) {
+    size_t len = 0;
+    for(size_t i = 0; i < count; i += 2) {
+        uint16_t a = pixels[i];
+        uint16_t a444 = ((a >> 4) & 0xF00) | ((a >> 3) & 0x0F0) | ((a >> 1) & 0x00F);
+        out[len++] = a444 >> 4;
+        if(i + 1 == count) {
+            out[len++] = (a444 & 0x0F) << 4;
+            break;
+        }
+        uint16_t b = pixels[i + 1];
+        uint16_t b444 = ((b >> 4) & 0xF00) | ((b >> 3) & 0x0F0) | ((b >> 1) & 0x00F);
+        out[len++] = ((a444 & 0x0F) << 4) | (b444 >> 8);
+        out[len++] = b444 & 0xFF;
+    }
+    return len;
+}
+
+static void toBigEndian(const uint16_t *pixels, size_t count, uint8_t *out) {
+    for(size_t i = 0; i < count; i++) {
+        out[2 * i] = pixels[i] >> 8;
+        out[2 * i + 1] = pixels[i] & 0xFF;
+    }
+}
+
+// Distinct values in every channel, so a bit from the wrong place shows
+static void makePixels(uint16_t *pixels, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        pixels[i] = (uint16_t)(i * 0x9E37 + 0x1234);
+    }
+}
+
+// Data bytes following the nth RAMWR (from 0) must be exactly expected
+static void expectPixelDataAt(int nth, const uint8_t *expected, size_t len) {
+    size_t pos = 0;
+    for(;; pos++) {
+        assert(pos < fakePanelLen);
+        if(!fakePanelBus[pos].dc && fakePanelBus[pos].byte == ST7735_RAMWR && nth-- == 0) break;
+    }
+    pos++;
+    assert(FakePanel_DataRun(pos) == len);
+    for(size_t i = 0; i < len; i++) {
+        assert(fakePanelBus[pos + i].byte == expected[i]);
+    }
+}
+
+static void expectPixelData(const uint8_t *expected, size_t len) {
+    expectPixelDataAt(0, expected, len);
+}
+
+static void testImage(size_t count) {
+    uint16_t pixels[200];
+    uint8_t data[400], expected[300];
+    assert(count <= 200);
+    makePixels(pixels, count);
+    toBigEndian(pixels, count, data);
+    size_t len = pack(pixels, count, expected);
+
+    FakePanel_Clear();
+    ST7735_DrawImage(0, 0, count, 1, data);
+    expectPixelData(expected, len);
+}
+
+// A stream split at every odd pixel must match one write of the same pixels
+static void testStreamCarry(void) {
+    static const size_t splits[] = { 1, 2, 1, 3, 5, 16, 17, 1, 30, 33 };
+    uint16_t pixels[200];
+    uint8_t data[400], expected[300];
+    size_t count = 0;
+    for(size_t i = 0; i < count_of(splits); i++) count += splits[i];
+    makePixels(pixels, count);
+    toBigEndian(pixels, count, data);
+    size_t len = pack(pixels, count, expected);
+
+    FakePanel_Clear();
+    ST7735_BeginPixels(0, 0, count, 1);
+    size_t at = 0;
+    for(size_t i = 0; i < count_of(splits); i++) {
+        ST7735_WritePixels(&data[2 * at], 2 * splits[i]);
+        at += splits[i];
+    }
+    ST7735_EndPixels();
+    expectPixelData(expected, len);
+}
+
+// The held-back pixel must not leak into the next window
+static void testFlushBetweenWindows(void) {
+    uint16_t pixels[3];
+    uint8_t data[6], expected[5];
+    makePixels(pixels, 3);
+    toBigEndian(pixels, 3, data);
+
+    FakePanel_Clear();
+    ST7735_BeginPixels(0, 0, 1, 1);
+    ST7735_WritePixels(data, 2);
+    ST7735_EndPixels();
+    ST7735_BeginPixels(0, 0, 2, 1);
+    ST7735_WritePixels(&data[2], 4);
+    ST7735_EndPixels();
+
+    size_t len = pack(pixels, 1, expected);
+    expectPixelDataAt(0, expected, len);
+    len = pack(&pixels[1], 2, expected);
+    expectPixelDataAt(1, expected, len);
+}
+
+static void testFill(uint32_t count) {
+    static uint16_t pixels[ST7735_WIDTH * ST7735_HEIGHT];
+    static uint8_t expected[ST7735_WIDTH * ST7735_HEIGHT * 3 / 2 + 2];
+    const uint16_t color = 0xA5C3;
+    for(uint32_t i = 0; i < count; i++) pixels[i] = color;
+    size_t len = pack(pixels, count, expected);
+
+    FakePanel_Clear();
+    // One row at a time up to the panel width, then whole rows
+    if(count <= ST7735_WIDTH) ST7735_FillRectangle(0, 0, count, 1, color);
+    else ST7735_FillRectangle(0, 0, ST7735_WIDTH, count / ST7735_WIDTH, color);
+    expectPixelData(expected, len);
+}
+
+int main(void) {
+    ST7735_Init();
+
+    static const size_t imageCounts[] = { 1, 2, 3, 4, 31, 32, 33, 63, 64, 65, 199 };
+    for(size_t i = 0; i < count_of(imageCounts); i++) testImage(imageCounts[i]);
+    testStreamCarry();
+    testFlushBetweenWindows();
+    // 32 pixels fill the packer's buffer exactly
+    static const uint32_t fillCounts[] = { 1, 2, 3, 31, 32, 33, 64, 65, 79, 80,
+                                           ST7735_WIDTH * 3, ST7735_WIDTH * ST7735_HEIGHT };
+    for(size_t i = 0; i < count_of(fillCounts); i++) testFill(fillCounts[i]);
+
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,88 @@
+/* vim: set ai et ts=4 sw=4: */
+// ST7735_DrawImageCompressed against the output of tools/rle_image.py: the
+// logo, encoded at build time, must reach the panel exactly as the raw
+// pixels it was made from.
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "fake_panel.h"
+#include "st7735.h"
+#include "arducam_logo_rle.h"
+
+extern const uint8_t arducam_logo[25608];
+// Bytes before the pixels in the raw array, as passed to rle_image.py --skip
+#define LOGO_HEADER 8
+
+// Data bytes following the first RAMWR must be exactly expected
+static void expectPixelData(const uint8_t *expected, size_t len) {
+    size_t pos = 0;
+    while(fakePanelBus[pos].dc || fakePanelBus[pos].byte != ST7735_RAMWR) {
+        pos++;
+        assert(pos < fakePanelLen);
+    }
+    pos++;
+    assert(FakePanel_DataRun(pos) == len);
+    for(size_t i = 0; i < len; i++) {
+        assert(fakePanelBus[pos + i].byte == expected[i]);
+    }
+}
+
+static void testLogo(void) {
+    const size_t len = ARDUCAM_LOGO_RLE_WIDTH * ARDUCAM_LOGO_RLE_HEIGHT * 2;
+    assert(LOGO_HEADER + len <= sizeof(arducam_logo));
+
+    FakePanel_Clear();
+    ST7735_DrawImageCompressed(0, 0, ARDUCAM_LOGO_RLE_WIDTH, ARDUCAM_LOGO_RLE_HEIGHT, arducam_logo_rle);
+    expectPixelData(&arducam_logo[LOGO_HEADER], len);
+    printf("logo: %u bytes raw, %u encoded\n", (unsigned)len, (unsigned)sizeof(arducam_logo_rle));
+}
+
+// Packets running across rows, and the longest run and literal packets
+static void testPacketsAcrossRows(void) {
+    static uint8_t stream[1 + 2 + 1 + 2 * 3 + 1 + 2 + 1 + 2 * 128];
+    static uint8_t expected[2 * (5 + 3 + 128 + 128)];
+    size_t s = 0, e = 0;
+
+    // Run of 5, literal of 3, run of 128, literal of 128
+    stream[s++] = 0x80 | 4;
+    stream[s++] = 0xAB;
+    stream[s++] = 0xCD;
+    for(int i = 0; i < 5; i++) {
+        expected[e++] = 0xAB;
+        expected[e++] = 0xCD;
+    }
+    stream[s++] = 2;
+    for(int i = 0; i < 3; i++) {
+        stream[s++] = expected[e++] = 0x10 + i;
+        stream[s++] = expected[e++] = 0x20 + i;
+    }
+    stream[s++] = 0x80 | 127;
+    stream[s++] = 0x12;
+    stream[s++] = 0x34;
+    for(int i = 0; i < 128; i++) {
+        expected[e++] = 0x12;
+        expected[e++] = 0x34;
+    }
+    stream[s++] = 127;
+    for(int i = 0; i < 128; i++) {
+        stream[s++] = expected[e++] = i;
+        stream[s++] = expected[e++] = 255 - i;
+    }
+    assert(s == sizeof(stream) && e == sizeof(expected));
+
+    // Rows of 4 pixels split every packet
+    FakePanel_Clear();
+    ST7735_DrawImageCompressed(0, 0, 4, sizeof(expected) / 2 / 4, stream);
+    expectPixelData(expected, sizeof(expected));
+}
+
+int main(void) {
+    ST7735_Init();
+
+    testLogo();
+    testPacketsAcrossRows();
+
+    printf("ok\n");
+    return 0;
+}
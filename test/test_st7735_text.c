@@ -0,0 +1,60 @@
+/* vim: set ai et ts=4 sw=4: */
+// Glyph cache and line fast path: a line of at most ST7735_GLYPH_CACHE_SIZE
+// distinct characters is drawn from the cache after its first pass, as one
+// window.
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "fake_panel.h"
+#include "fonts.h"
+#include "st7735.h"
+
+static size_t countCommands(uint8_t cmd) {
+    size_t count = 0;
+    for(size_t i = 0; i < fakePanelLen; i++) {
+        if(!fakePanelBus[i].dc && fakePanelBus[i].byte == cmd) count++;
+    }
+    return count;
+}
+
+static void testLineFromCache(void) {
+    static const char digits[] = "01234567";
+    ST7735_TextStats text;
+
+    // The game's landscape turn, 160 wide: eight 16 px glyphs on one line
+    ST7735_SetRotation(1);
+    ST7735_ResetTextStats();
+    ST7735_WriteString(0, 0, digits, Font_16x26, ST7735_WHITE, ST7735_BLACK);
+    ST7735_GetTextStats(&text);
+    assert(text.misses == 8 && text.hits == 0 && text.chars == 8);
+
+    FakePanel_Clear();
+    ST7735_WriteString(0, 0, digits, Font_16x26, ST7735_WHITE, ST7735_BLACK);
+    ST7735_GetTextStats(&text);
+    assert(text.misses == 8 && text.hits == 8 && text.chars == 16);
+    assert(countCommands(ST7735_RAMWR) == 1);
+    assert(FakePanel_DataRun(fakePanelLen - 8 * 16 * 26 * 2) == 8 * 16 * 26 * 2);
+}
+
+// Ten distinct glyphs cycling through eight entries evict each other before
+// they come round again
+static void testTooManyGlyphs(void) {
+    ST7735_TextStats text;
+    ST7735_WriteString(0, 0, "0123456789", Font_16x26, ST7735_WHITE, ST7735_BLACK);
+    ST7735_ResetTextStats();
+    for(int i = 0; i < 3; i++)
+        ST7735_WriteString(0, 0, "0123456789", Font_16x26, ST7735_WHITE, ST7735_BLACK);
+    ST7735_GetTextStats(&text);
+    assert(text.hits == 0 && text.misses == 30);
+}
+
+int main(void) {
+    ST7735_Init();
+
+    testLineFromCache();
+    testTooManyGlyphs();
+
+    printf("ok\n");
+    return 0;
+}
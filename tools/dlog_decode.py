@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Decode the binary deferred log records written by DLog_Drain when the
+firmware is built with DLOG_BINARY=1.
+
+Each record arrives as a line
+  dlog <format address> <timestamp us> <arg0> <arg1> <arg2>
+with every field in hex. The format strings are looked up by address in the
+firmware ELF (build/src/pong.elf) and formatted on the host, so the board
+never runs printf for them.
+
+Input is a captured log, '-' for stdin, or a serial port (needs pyserial),
+which is followed until interrupted.
+"""
+
+import argparse
+import os
+import re
+import stat
+import struct
+import sys
+
+SHT_NOBITS = 8
+SHF_ALLOC = 2
+
+CONVERSION = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z|t)?([diuxXoc%])")
+
+
+class Elf:
+    """Just enough of ELF32 to read initialised data by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1:
+            sys.exit("%s is not a 32-bit ELF file" % path)
+        shoff, = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", self.data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            (_, sh_type, flags, addr, offset, size,
+             _, _, _, _) = struct.unpack_from("<10I", self.data, shoff + i * shentsize)
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and size:
+                self.sections.append((addr, offset, size))
+
+    def string(self, addr):
+        for base, offset, size in self.sections:
+            if base <= addr < base + size:
+                start = offset + addr - base
+                end = self.data.index(b"\0", start)
+                return self.data[start:end].decode("ascii", "replace")
+        return None
+
+
+def format_record(fmt, args):
+    args = iter(args)
+
+    def convert(match):
+        flags, kind = match.groups()
+        if kind == "%":
+            return "%"
+        value = next(args, 0)
+        if kind in "di" and value & 0x80000000:
+            value -= 1 << 32
+        if kind == "c":
+            return chr(value & 0xFF)
+        return ("%" + flags + ("d" if kind in "iu" else kind)) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def decode(lines, elf, out):
+    for line in lines:
+        fields = line.split()
+        if len(fields) != 6 or fields[0] != "dlog":
+            out.write(line)
+            continue
+        addr, timestamp, *args = (int(v, 16) for v in fields[1:])
+        fmt = elf.string(addr)
+        if fmt is None:
+            out.write("[%10u] <unknown format 0x%08x> %s\n" % (timestamp, addr, " ".join(fields[3:])))
+        else:
+            out.write("[%10u] %s" % (timestamp, format_record(fmt, args)))
+        out.flush()
+
+
+def serial_lines(port):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is needed to talk to %s" % port)
+    with serial.Serial(port) as s:
+        while True:
+            yield s.readline().decode("ascii", "replace")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="firmware ELF the board is running")
+    parser.add_argument("input", help="serial port, captured log, or - for stdin")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    try:
+        if args.input == "-":
+            decode(sys.stdin, elf, sys.stdout)
+        elif stat.S_ISCHR(os.stat(args.input).st_mode):
+            decode(serial_lines(args.input), elf, sys.stdout)
+        else:
+            with open(args.input) as f:
+                decode(f, elf, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Host model of the input-to-photon pipeline, for trying scheduling changes
+before flashing them.
+
+It replays the firmware's work queue: periodic timers post the ball, IMU,
+user paddle, AI paddle and repaint tasks, and a single non-preemptive
+executor runs the highest priority pending task (ties go to the task
+registered first, as in WQ_RunOnce). Tilt inputs arrive at random times.
+Each is seen by the first IMU read that starts after it, moves the paddle
+at the first paddle tick after that read, and shows up when the following
+repaint has sent the paddle over SPI. The sensor's own filter delay is not
+modelled, as the board's report leaves it out too.
+
+Reported like the board's latency mode ('p' on the console): "read" runs
+from the start of the IMU read to the end of the paddle paint, which is
+what Latency_Report calls total. "input" adds the wait for that read.
+
+Example: compare the default 16 ms repaint timer with posting a repaint
+straight after each paddle update, or reading the IMU at half the rate.
+  tools/latency_sim.py
+  tools/latency_sim.py --event-driven
+  tools/latency_sim.py --imu-ms 8
+"""
+
+import argparse
+import bisect
+import random
+
+
+class Task:
+    def __init__(self, name, priority, period_us, cost_us, phase_us=0):
+        self.name = name
+        self.priority = priority
+        self.period_us = period_us
+        self.cost_us = cost_us
+        self.next_post = phase_us
+        self.pending = False
+        self.runs = []
+
+
+def run_executor(tasks, horizon_us, rng, args):
+    paddle = next(t for t in tasks if t.name == "userPaddle")
+    repaint = next(t for t in tasks if t.name == "repaint")
+    now = 0.0
+    while now < horizon_us:
+        for task in tasks:
+            while task.period_us and task.next_post <= now:
+                task.pending = True
+                task.next_post += task.period_us
+        ready = [t for t in tasks if t.pending]
+        if not ready:
+            now = min(t.next_post for t in tasks if t.period_us)
+            continue
+        task = min(ready, key=lambda t: (t.priority, tasks.index(t)))
+        task.pending = False
+        cost = task.cost_us(rng) if callable(task.cost_us) else task.cost_us
+        task.runs.append((now, now + cost))
+        now += cost
+        if args.event_driven and task is paddle:
+            repaint.pending = True
+
+
+def percentile(values, fraction):
+    return values[min(len(values) - 1, int(len(values) * fraction))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--poll-ms", type=float, default=16, help="user paddle period")
+    parser.add_argument("--repaint-ms", type=float, default=16, help="repaint period")
+    parser.add_argument("--repaint-phase-ms", type=float, default=0,
+                        help="repaint timer offset from the paddle timer")
+    parser.add_argument("--event-driven", action="store_true",
+                        help="post a repaint as soon as the paddle task has run")
+    parser.add_argument("--imu-ms", type=float, default=4,
+                        help="IMU read period (imuPeriodMillis for the low-latency preset)")
+    parser.add_argument("--i2c-us", type=float, default=380,
+                        help="time for one burst read of both sensors at 400 kHz")
+    parser.add_argument("--i2c-jitter-us", type=float, default=20,
+                        help="extra random time per read (clock stretching, retries)")
+    parser.add_argument("--paddle-us", type=float, default=5,
+                        help="time to move the user paddle from the latest tilt")
+    parser.add_argument("--paddle-spi-us", type=float, default=450,
+                        help="time to paint the user paddle")
+    parser.add_argument("--other-spi-us", type=float, default=400,
+                        help="rest of a repaint: AI paddle, divider, ball")
+    parser.add_argument("--ball-us", type=float, default=5)
+    parser.add_argument("--inputs", type=int, default=20000)
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    poll = args.poll_ms * 1000
+
+    # Registration order and priorities as in main.c
+    tasks = [
+        Task("ball", 0, poll, args.ball_us),
+        Task("imu", 1, args.imu_ms * 1000, lambda r: args.i2c_us + r.uniform(0, args.i2c_jitter_us)),
+        Task("userPaddle", 1, poll, args.paddle_us),
+        Task("aiPaddle", 1, poll * 3, args.ball_us),
+        Task("repaint", 2, 0 if args.event_driven else args.repaint_ms * 1000,
+             args.paddle_spi_us + args.other_spi_us, args.repaint_phase_ms * 1000),
+    ]
+    imu, paddle, repaint = tasks[1], tasks[2], tasks[4]
+
+    horizon = args.inputs * poll / 4 + 10 * poll
+    run_executor(tasks, horizon, rng, args)
+
+    imu_starts = [start for start, _ in imu.runs]
+    paddle_starts = [start for start, _ in paddle.runs]
+    repaint_starts = [start for start, _ in repaint.runs]
+    from_input, from_read = [], []
+    for _ in range(args.inputs):
+        t = rng.uniform(0, horizon - 5 * poll)
+        i = bisect.bisect_left(imu_starts, t)
+        read_start, acquired = imu.runs[i]
+        k = bisect.bisect_left(paddle_starts, acquired)
+        if k == len(paddle_starts):
+            continue
+        updated = paddle.runs[k][1]
+        j = bisect.bisect_left(repaint_starts, updated)
+        if j == len(repaint_starts):
+            continue
+        photon = repaint_starts[j] + args.paddle_spi_us
+        from_input.append(photon - t)
+        from_read.append(photon - read_start)
+
+    print("%-6s %8s %8s %8s %8s  (us, %d inputs)" % ("", "min", "median", "p99", "max", len(from_input)))
+    for name, values in (("input", from_input), ("read", from_read)):
+        values.sort()
+        print("%-6s %8.0f %8.0f %8.0f %8.0f" % (name, values[0], percentile(values, 0.5),
+                                                percentile(values, 0.99), values[-1]))
+
+
+if __name__ == "__main__":
+    main()
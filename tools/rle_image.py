@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""Convert a raw RGB565 image into the run-length encoded format understood by
+ST7735_DrawImageCompressed and write it out as a C array.
+
+The input is either a raw big-endian RGB565 file or a uint8_t array in an
+existing C source (such as arducam_logo in src/images/arducam_logo.c).
+
+Encoded stream: a sequence of packets, each starting with a control byte c.
+  c & 0x80  run:     the next pixel (2 bytes) is repeated (c & 0x7F) + 1 times
+  otherwise literal: (c + 1) pixels follow, 2 bytes each
+Pixels are kept big-endian, exactly as the panel expects them.
+"""
+
+import argparse
+import re
+import sys
+
+MAX_PACKET = 128
+
+
+def read_c_array(path, name):
+    with open(path) as f:
+        source = f.read()
+    match = re.search(r"\b%s\s*\[[^\]]*\]\s*=\s*\{(.*?)\}\s*;" % re.escape(name),
+                      source, re.S)
+    if not match:
+        sys.exit("array %s not found in %s" % (name, path))
+    return bytes(int(v, 0) for v in match.group(1).replace("\n", "").split(",")
+                 if v.strip())
+
+
+def encode(pixels):
+    out = bytearray()
+    i = 0
+    n = len(pixels)
+    while i < n:
+        run = 1
+        while i + run < n and run < MAX_PACKET and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            out.append(0x80 | (run - 1))
+            out += pixels[i].to_bytes(2, "big")
+            i += run
+            continue
+
+        # Gather literals until the next run of two or more starts
+        start = i
+        while i < n and i - start < MAX_PACKET:
+            if i + 1 < n and pixels[i + 1] == pixels[i]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        for p in pixels[start:i]:
+            out += p.to_bytes(2, "big")
+    return bytes(out)
+
+
+def decode(data, count):
+    pixels = []
+    i = 0
+    while len(pixels) < count:
+        c = data[i]
+        i += 1
+        if c & 0x80:
+            pixels += [int.from_bytes(data[i:i + 2], "big")] * ((c & 0x7F) + 1)
+            i += 2
+        else:
+            for _ in range(c + 1):
+                pixels.append(int.from_bytes(data[i:i + 2], "big"))
+                i += 2
+    return pixels
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="raw RGB565 file, or C source with --array")
+    parser.add_argument("--array", help="name of the uint8_t array to read from a C source")
+    parser.add_argument("--skip", type=int, default=0, help="header bytes to drop from the input")
+    parser.add_argument("--width", type=int, required=True)
+    parser.add_argument("--height", type=int, required=True)
+    parser.add_argument("--name", required=True, help="name of the generated array")
+    parser.add_argument("--out-c", required=True)
+    parser.add_argument("--out-h", required=True)
+    args = parser.parse_args()
+
+    if args.array:
+        raw = read_c_array(args.input, args.array)
+    else:
+        with open(args.input, "rb") as f:
+            raw = f.read()
+    raw = raw[args.skip:]
+
+    count = args.width * args.height
+    if len(raw) < count * 2:
+        sys.exit("input holds %d bytes, %dx%d needs %d" %
+                 (len(raw), args.width, args.height, count * 2))
+    pixels = [int.from_bytes(raw[i:i + 2], "big") for i in range(0, count * 2, 2)]
+
+    encoded = encode(pixels)
+    if decode(encoded, count) != pixels:
+        sys.exit("round trip failed for %s" % args.name)
+
+    guard = "__%s_H__" % args.name.upper()
+    with open(args.out_h, "w") as f:
+        f.write("/* Generated by tools/rle_image.py, do not edit. */\n")
+        f.write("#ifndef %s\n#define %s\n\n#include <stdint.h>\n\n" % (guard, guard))
+        f.write("#define %s_WIDTH  %d\n" % (args.name.upper(), args.width))
+        f.write("#define %s_HEIGHT %d\n\n" % (args.name.upper(), args.height))
+        f.write("extern const uint8_t %s[%d];\n\n#endif // %s\n" % (args.name, len(encoded), guard))
+
+    with open(args.out_c, "w") as f:
+        f.write("/* Generated by tools/rle_image.py, do not edit. */\n")
+        f.write("/* %d bytes raw, %d bytes encoded */\n" % (count * 2, len(encoded)))
+        f.write("#include \"%s.h\"\n\n" % args.name)
+        f.write("const uint8_t %s[%d] = {\n" % (args.name, len(encoded)))
+        for i in range(0, len(encoded), 16):
+            f.write("  " + ",".join("0x%02X" % b for b in encoded[i:i + 16]) + ",\n")
+        f.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+"""Replay tilt samples through the paddle controllers on the host, to tune
+the filters and speed curve before flashing them.
+
+Samples come from the board's tilt recording ('a' on the console), which
+logs the x reading and the gyro's rate of change of it for every IMU
+sample:
+  [  12345678] tilt -231 1840
+(run binary logs through tools/dlog_decode.py first). Without a log, a
+synthetic recording is made at the game's 250 Hz IMU reads: slow tilts
+either way and a sharp flick, with sensor noise, hand jolts on the
+accelerometer and bias on the gyro.
+
+Four controllers run, all in the firmware's integer arithmetic, moving
+their paddle every 16 ms tick from the latest tilt:
+  bangbang  the old control, 2 px per tick past +-300 mg
+  raw       proportional speed from the unfiltered reading
+  filtered  proportional speed from the alpha-beta filter (src/lib/tilt.c)
+  fused     proportional speed from the gyro complementary filter
+
+For each tilt estimate it reports the rms change per sample (noise) and
+how many samples it trails the reference. The reference is the true tilt
+for synthetic data and the raw reading for a log. For each paddle it
+reports how far it travelled and how often it changed direction; jitter
+shows up as many reversals. Paddles start mid-screen so the walls hide as
+little as possible. --csv writes every sample for plotting.
+
+Example: compare a lighter blend against the default.
+  tools/tilt_sim.py capture.log
+  tools/tilt_sim.py capture.log --blend 32
+"""
+
+import argparse
+import csv
+import random
+import re
+import sys
+
+# Defaults from src/lib/tilt.h and the game geometry
+ALPHA = 128
+BETA = 32
+BLEND = 8
+MAX_GAP_US = 50000
+DEAD_ZONE_MG = 50
+FULL_MG = 600
+MAX_SPEED_Q8 = 6 << 8
+GAME_HEIGHT = 80
+PADDLE_HEIGHT = 30
+TICK_US = 16000
+IMU_US = 4000
+
+SAMPLE = re.compile(r"\[\s*(\d+)\]\s+tilt\s+(-?\d+)(?:\s+(-?\d+))?")
+
+
+def read_log(path):
+    samples = []
+    with (sys.stdin if path == "-" else open(path)) as f:
+        for line in f:
+            match = SAMPLE.search(line)
+            if match:
+                rate = match.group(3)
+                samples.append((int(match.group(1)), int(match.group(2)),
+                                int(rate) if rate is not None else None))
+    return samples
+
+
+def synthetic(rng, args):
+    """Return (samples, truth): (us, accel mg, gyro mg/s) and the true mg."""
+    truth = []
+
+    def hold(mg, ms):
+        truth.extend([mg] * (ms * 1000 // IMU_US))
+
+    def ramp(start_mg, end_mg, ms):
+        ticks = ms * 1000 // IMU_US
+        truth.extend(start_mg + (end_mg - start_mg) * i // ticks for i in range(ticks))
+
+    hold(0, 480)
+    ramp(0, 200, 640)
+    hold(200, 320)
+    ramp(200, -200, 960)
+    hold(-200, 320)
+    ramp(-200, 0, 640)
+    ramp(0, 600, 40)                       # flick
+    hold(600, 40)
+    ramp(600, 0, 40)
+    hold(0, 640)
+
+    samples = []
+    jolt = 0.0
+    for i, mg in enumerate(truth):
+        if rng.random() < 0.02:
+            jolt = rng.choice((-1, 1)) * rng.uniform(50, 150)
+        jolt *= 0.7
+        accel = mg + jolt + rng.gauss(0, args.noise)
+        slope = (truth[min(i + 1, len(truth) - 1)] - truth[max(i - 1, 0)]) / 2
+        rate = slope * 1e6 / IMU_US + args.gyro_bias + rng.gauss(0, args.gyro_noise)
+        samples.append((i * IMU_US, int(accel), int(rate)))
+    return samples, truth
+
+
+class AlphaBeta:
+    """Tilt_FilterStep, including its shifts and 32-bit scaling."""
+
+    def __init__(self, mg, alpha, beta):
+        self.value = mg << 8
+        self.rate = 0
+        self.alpha = alpha
+        self.beta = beta
+
+    def step(self, mg):
+        predicted = self.value + self.rate
+        error = (mg << 8) - predicted
+        self.value = predicted + ((error * self.alpha) >> 8)
+        self.rate += (error * self.beta) >> 8
+        return self.value >> 8
+
+
+class Fusion:
+    """Tilt_FusionStep."""
+
+    def __init__(self, mg, blend):
+        self.value = mg << 8
+        self.blend = blend
+
+    def step(self, mg, rate, dt_us):
+        if dt_us > MAX_GAP_US:
+            self.value = mg << 8
+            return mg
+        self.value += int(rate * dt_us * 256 / 1000000)
+        self.value += ((mg << 8) - self.value) * self.blend >> 8
+        return self.value >> 8
+
+
+def speed(mg, args):
+    """Tilt_Speed, truncating like C."""
+    magnitude = abs(mg)
+    if magnitude <= args.dead_zone:
+        return 0
+    result = args.max_speed
+    if magnitude < args.full:
+        result = (magnitude - args.dead_zone) * args.max_speed // (args.full - args.dead_zone)
+    return -result if mg < 0 else result
+
+
+class Paddle:
+    def __init__(self):
+        self.q8 = ((GAME_HEIGHT - PADDLE_HEIGHT) // 2) << 8
+        self.ys = []
+
+    def move(self, delta_q8):
+        limit = (GAME_HEIGHT - PADDLE_HEIGHT) << 8
+        self.q8 = min(max(self.q8 + delta_q8, 0), limit)
+        self.ys.append(self.q8 >> 8)
+
+
+def bangbang(mg):
+    if mg > 300:
+        return 2 << 8
+    if mg < -300:
+        return -2 << 8
+    return 0
+
+
+def travel(ys):
+    return sum(abs(b - a) for a, b in zip(ys, ys[1:]))
+
+
+def reversals(ys):
+    count = 0
+    direction = 0
+    for a, b in zip(ys, ys[1:]):
+        if b != a:
+            step = 1 if b > a else -1
+            if direction and step != direction:
+                count += 1
+            direction = step
+    return count
+
+
+def roughness(values):
+    steps = [(b - a) ** 2 for a, b in zip(values, values[1:])]
+    return (sum(steps) / len(steps)) ** 0.5 if steps else 0.0
+
+
+def lag(raw, filtered, max_shift=20):
+    """Shift, in samples, that best lines the filtered tilt up with the raw."""
+    best = None
+    for shift in range(max_shift + 1):
+        pairs = list(zip(raw, filtered[shift:]))
+        if not pairs:
+            break
+        err = sum((a - b) ** 2 for a, b in pairs) / len(pairs)
+        if best is None or err < best[1]:
+            best = (shift, err)
+    return best[0]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", nargs="?", help="captured console log, or - for stdin")
+    parser.add_argument("--alpha", type=int, default=ALPHA, help="TILT_ALPHA, in 1/256ths")
+    parser.add_argument("--beta", type=int, default=BETA, help="TILT_BETA, in 1/256ths")
+    parser.add_argument("--dead-zone", type=int, default=DEAD_ZONE_MG, help="TILT_DEAD_ZONE_MG")
+    parser.add_argument("--full", type=int, default=FULL_MG, help="TILT_FULL_MG")
+    parser.add_argument("--max-speed", type=int, default=MAX_SPEED_Q8,
+                        help="TILT_MAX_SPEED_Q8, pixels per tick scaled by 256")
+    parser.add_argument("--blend", type=int, default=BLEND, help="TILT_BLEND, in 1/256ths")
+    parser.add_argument("--noise", type=float, default=25, help="synthetic accel noise, mg rms")
+    parser.add_argument("--gyro-noise", type=float, default=300,
+                        help="synthetic gyro noise, mg/s rms")
+    parser.add_argument("--gyro-bias", type=float, default=50, help="synthetic gyro bias, mg/s")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--csv", help="write every sample to this file")
+    args = parser.parse_args()
+
+    truth = None
+    if args.log:
+        samples = read_log(args.log)
+        if not samples:
+            sys.exit("no tilt samples in %s" % args.log)
+    else:
+        samples, truth = synthetic(random.Random(args.seed), args)
+
+    raw = [mg for _, mg, _ in samples]
+    estimates = {"raw": raw}
+    flt = AlphaBeta(raw[0], args.alpha, args.beta)
+    estimates["filtered"] = [flt.step(mg) for mg in raw]
+    if all(rate is not None for _, _, rate in samples):
+        fusion = Fusion(raw[0], args.blend)
+        fused = []
+        last = samples[0][0]
+        for t, mg, rate in samples:
+            fused.append(fusion.step(mg, rate, t - last))
+            last = t
+        estimates["fused"] = fused
+
+    paddles = {name: Paddle() for name in ["bangbang"] + list(estimates)}
+    tick_of = []
+    next_tick = samples[0][0]
+    for i, (t, mg, _) in enumerate(samples):
+        if t >= next_tick:
+            next_tick += TICK_US
+            paddles["bangbang"].move(bangbang(mg))
+            for name, values in estimates.items():
+                paddles[name].move(speed(values[i], args))
+        tick_of.append(len(paddles["bangbang"].ys) - 1)
+
+    reference = truth if truth else raw
+    print("%d samples over %.1f s, against the %s tilt" %
+          (len(samples), (samples[-1][0] - samples[0][0]) / 1e6, "true" if truth else "raw"))
+    print("%-10s %10s %8s %8s" % ("tilt", "noise mg", "lag", "err mg"))
+    for name, values in estimates.items():
+        err = (sum((a - b) ** 2 for a, b in zip(reference, values)) / len(values)) ** 0.5
+        print("%-10s %10.1f %8d %8.1f" % (name, roughness(values), lag(reference, values), err))
+    print("%-10s %10s %8s" % ("paddle", "travel", "reversals"))
+    for name, paddle in paddles.items():
+        print("%-10s %10d %8d" % (name, travel(paddle.ys), reversals(paddle.ys)))
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            out = csv.writer(f)
+            out.writerow(["us"] + ["%s_mg" % n for n in estimates] +
+                         (["true_mg"] if truth else []) + ["%s_y" % n for n in paddles])
+            for i, (t, _, _) in enumerate(samples):
+                out.writerow([t] + [v[i] for v in estimates.values()] +
+                             ([truth[i]] if truth else []) +
+                             [p.ys[tick_of[i]] for p in paddles.values()])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""Convert the trace rings dumped by Trace_Dump into Chrome trace_event JSON,
+viewable in chrome://tracing or https://ui.perfetto.dev.
+
+Given a serial port (e.g. /dev/ttyACM0) the script sends 't' and reads the
+reply, which needs pyserial. Given a file, or '-' for stdin, it reads a
+captured log instead and converts the last dump in it.
+
+Records are 8 bytes, little-endian: uint32 timestamp in microseconds, then
+core, event id and phase (0 begin, 1 end) bytes and one reserved byte.
+"""
+
+import argparse
+import json
+import os
+import stat
+import struct
+import sys
+
+RECORD = struct.Struct("<IBBBx")
+
+
+def parse(lines):
+    """Return (names, {core: [records]}) for the last complete dump."""
+    result = None
+    names, raw, core = {}, {}, None
+    for line in lines:
+        fields = line.split()
+        if len(fields) < 2 or fields[0] != "trace":
+            continue
+        kind = fields[1]
+        if kind == "name":
+            if core is not None:
+                names, raw, core = {}, {}, None
+            names[int(fields[2])] = fields[3]
+        elif kind == "core":
+            core = int(fields[2])
+            raw[core] = bytearray()
+        elif kind == "rec" and core is not None:
+            raw[core] += bytes.fromhex(fields[2])
+        elif kind == "end":
+            result = (names, raw)
+            names, raw, core = {}, {}, None
+    if result is None:
+        sys.exit("no complete trace dump found")
+    names, raw = result
+    return names, {c: [RECORD.unpack_from(data, off)
+                       for off in range(0, len(data), RECORD.size)]
+                   for c, data in raw.items()}
+
+
+def to_events(names, rings):
+    events = []
+    for core, records in sorted(rings.items()):
+        events.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": core,
+                       "args": {"name": "core%d" % core}})
+        # Timestamps are a free-running 32-bit counter; unwrap them
+        base = 0
+        prev = None
+        for timestamp, rec_core, event, phase in records:
+            if prev is not None and timestamp < prev:
+                base += 1 << 32
+            prev = timestamp
+            events.append({
+                "name": names.get(event, "event%d" % event),
+                "ph": "E" if phase else "B",
+                "ts": base + timestamp,
+                "pid": 0,
+                "tid": rec_core,
+            })
+    return events
+
+
+def read_serial(port, timeout):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is needed to talk to %s" % port)
+    with serial.Serial(port, timeout=timeout) as s:
+        s.reset_input_buffer()
+        s.write(b"t")
+        lines = []
+        while True:
+            line = s.readline().decode("ascii", "replace")
+            if not line:
+                sys.exit("no reply from %s" % port)
+            if line.startswith("trace disabled"):
+                sys.exit("tracing is compiled out, rebuild with TRACE_ENABLED=1")
+            lines.append(line)
+            if line.startswith("trace end"):
+                return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="serial port, captured log, or - for stdin")
+    parser.add_argument("-o", "--output", default="-", help="JSON file to write (default stdout)")
+    parser.add_argument("--timeout", type=float, default=2.0,
+                        help="seconds to wait for the board to answer")
+    args = parser.parse_args()
+
+    if args.input == "-":
+        lines = sys.stdin.readlines()
+    elif stat.S_ISCHR(os.stat(args.input).st_mode):
+        lines = read_serial(args.input, args.timeout)
+    else:
+        with open(args.input) as f:
+            lines = f.readlines()
+
+    names, rings = parse(lines)
+    trace = {"traceEvents": to_events(names, rings), "displayTimeUnit": "ms"}
+    if args.output == "-":
+        json.dump(trace, sys.stdout)
+    else:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+
+
+if __name__ == "__main__":
+    main()
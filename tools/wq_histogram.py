@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Render the work-queue jitter and execution-time histograms printed by
+WQ_PrintHistograms.
+
+Given a serial port (e.g. /dev/ttyACM0) the script sends 'h' and reads the
+reply, which needs pyserial. Given a file, or '-' for stdin, it reads a
+captured log instead and shows the last dump in it.
+
+Each dump line reads "hist <task> <jitter|exec> <count> ..." with one count
+per log2 bucket: bucket 0 is 0 us and bucket n is [2^(n-1), 2^n) us.
+"""
+
+import argparse
+import os
+import stat
+import sys
+
+BAR_WIDTH = 50
+
+
+def bucket_label(n, last):
+    if n == 0:
+        return "0"
+    low = 1 << (n - 1)
+    if n == 1:
+        return "1"
+    return ">=%d" % low if n == last else "%d-%d" % (low, (1 << n) - 1)
+
+
+def parse(lines):
+    dump = {}
+    for line in lines:
+        fields = line.split()
+        if len(fields) < 2 or fields[0] != "hist":
+            continue
+        if fields[1] == "end":
+            yield dump
+            dump = {}
+            continue
+        task, kind = fields[1], fields[2]
+        dump[(task, kind)] = [int(v) for v in fields[3:]]
+    if dump:
+        yield dump
+
+
+def render(dump, out):
+    for (task, kind), counts in sorted(dump.items()):
+        total = sum(counts)
+        out.write("%s %s (%d samples, us)\n" % (task, kind, total))
+        if not total:
+            continue
+        peak = max(counts)
+        last = len(counts) - 1
+        used = [i for i, c in enumerate(counts) if c]
+        for n in range(used[0], used[-1] + 1):
+            bar = "#" * (counts[n] * BAR_WIDTH // peak)
+            out.write("  %12s %8d %s\n" % (bucket_label(n, last), counts[n], bar))
+        out.write("\n")
+
+
+def read_serial(port, timeout):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is needed to talk to %s" % port)
+    with serial.Serial(port, timeout=timeout) as s:
+        s.reset_input_buffer()
+        s.write(b"h")
+        lines = []
+        while True:
+            line = s.readline().decode("ascii", "replace")
+            if not line:
+                sys.exit("no reply from %s" % port)
+            lines.append(line)
+            if line.startswith("hist end"):
+                return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="serial port, captured log, or - for stdin")
+    parser.add_argument("--timeout", type=float, default=2.0,
+                        help="seconds to wait for the board to answer")
+    args = parser.parse_args()
+
+    if args.input == "-":
+        lines = sys.stdin.readlines()
+    elif stat.S_ISCHR(os.stat(args.input).st_mode):
+        lines = read_serial(args.input, args.timeout)
+    else:
+        with open(args.input) as f:
+            lines = f.readlines()
+
+    dumps = list(parse(lines))
+    if not dumps:
+        sys.exit("no histogram dump found")
+    render(dumps[-1], sys.stdout)
+
+
+if __name__ == "__main__":
+    main()